@@ -0,0 +1,97 @@
+#ifndef BATCHSORTER_H
+#define BATCHSORTER_H
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "GraphAdjList.h"
+#include "GraphCSR.h"
+
+// algorithm used by 'BatchSorter'
+enum struct BatchSortAlgorithm {KAHN, CORMAN};
+
+// result of sorting one graph of a batch
+struct BatchSortResult {
+  std::vector <unsigned int> sorting;
+  // exception thrown while sorting the graph (e.g. 'GraphCycleException'), null if the graph
+  // has been sorted
+  std::exception_ptr error;
+
+  bool isSorted (void) const { return ! error; }
+};
+
+// buffers of one thread, which are reused for all graphs sorted by this thread
+struct BatchSortScratch;
+
+// This class sorts many independent graphs concurrently on a fixed pool of threads
+//
+// The threads are started once by the constructor and wait for the next batch, so sorting a
+// batch does not create any threads. The graphs of a batch are handed out in small chunks
+// using an atomic counter. Every thread keeps its own in-degrees, node colors and search stack,
+// which only grow, so after the first batches only the sortings themselves are allocated. The
+// result of every graph is either its sorting or the exception thrown for it, a graph with a
+// cycle does not affect the other graphs of the batch.
+//
+// The sortings are the same as the ones of 'topologicalSortCSR' / 'topologicalSortAdjList4'
+// (KAHN) and 'topologicalSortCormanCSR' / 'topologicalSortCormanAdjList3' (CORMAN).
+//
+// NOTE: Only one batch is sorted at a time, concurrent calls of 'sort' wait for each other.
+class BatchSorter {
+
+  unsigned int _nThreads;
+  std::vector <std::thread> _threads;
+  std::vector <std::unique_ptr <BatchSortScratch>> _scratch;
+
+  // batch, which is processed right now
+  std::mutex _mutex;
+  std::mutex _batchMutex;
+  std::condition_variable _batchStarted;
+  std::condition_variable _batchDone;
+  std::function <void (unsigned int)> _task;
+  unsigned long _nBatches;
+  unsigned int _nBusyThreads;
+  bool _stop;
+
+  // Function run by the threads of the pool
+  void work (const unsigned int threadId);
+
+  // Function to run 'task (threadId)' on all threads and to wait until all of them are done
+  void run (std::function <void (unsigned int)> task);
+
+  template <typename DAG>
+  std::vector <BatchSortResult> sortBatch (const std::vector <DAG> & dags, const BatchSortAlgorithm algorithm);
+
+public:
+
+  // Constructor
+  //
+  // 0 threads means one thread per hardware thread. The calling thread of 'sort' is one of
+  // them, so nThreads - 1 threads are started.
+  BatchSorter (const unsigned int nThreads = 0);
+
+  BatchSorter (const BatchSorter &) = delete;
+  BatchSorter & operator= (const BatchSorter &) = delete;
+
+  // Destructor, which stops the threads
+  ~BatchSorter ();
+
+  // Functions to sort every graph of 'dags', the i-th result belongs to the i-th graph
+  //
+  // time-complexity:
+  //      O(sum of (|V| + |E|) over all graphs / nThreads)
+  std::vector <BatchSortResult> sort (const std::vector <GraphCSR> & dags, const BatchSortAlgorithm algorithm = BatchSortAlgorithm::KAHN);
+
+  std::vector <BatchSortResult> sort (const std::vector <GraphAdjList> & dags, const BatchSortAlgorithm algorithm = BatchSortAlgorithm::KAHN);
+
+  // Function to give the amount of threads including the calling one
+  inline unsigned int nThreads (void) const {
+    return _nThreads;
+  }
+};
+
+#endif
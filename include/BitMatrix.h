@@ -0,0 +1,174 @@
+#ifndef BITMATRIX_H
+#define BITMATRIX_H
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+// This class can be used to represent a graph as a bit-packed adjacency matrix
+//
+// Every row is stored in 64-bit words, so one word holds 64 entries of the matrix. Next to
+// the row-major storage the transposed matrix is kept as well, so a row (outgoing edges) and a
+// column (incoming edges) of the matrix can both be processed word by word. Setting an entry
+// therefore costs two writes.
+class BitMatrix {
+
+  // number of rows and columns, which is the number of nodes
+  unsigned int _nNodes;
+  // number of 64-bit words per row
+  std::size_t _nWords;
+
+  // row-major storage and the storage of the transposed matrix
+  std::vector <uint64_t> _rows;
+  std::vector <uint64_t> _cols;
+
+  // function to check, whether a given node id is valid
+  inline void checkBounds (unsigned int nodeId) const {
+    if (nodeId >= _nNodes)
+      throw std::invalid_argument ("Error: matrix index out of bounce.");
+  }
+
+public:
+
+  typedef unsigned int NodeIdType;
+
+  // Range over the columns of the set bits of a single row, which are the target nodes of the
+  // outgoing edges of a node
+  class AdjacentNodes {
+    const uint64_t * _words;
+    std::size_t _nWords;
+
+  public:
+    class iterator {
+      const uint64_t * _words;
+      std::size_t _nWords;
+      std::size_t _word;
+      uint64_t _bits;
+
+      // skip the words without any set bit
+      void skipEmptyWords (void) {
+        while (_bits == 0 && ++_word < _nWords)
+          _bits = _words[_word];
+      }
+
+    public:
+      iterator (const uint64_t * words, const std::size_t nWords, const std::size_t word)
+        : _words (words)
+        , _nWords (nWords)
+        , _word (word)
+        , _bits (word < nWords ? words[word] : 0)
+      {
+        if (_word < _nWords)
+          skipEmptyWords();
+      }
+
+      unsigned int operator* (void) const { return _word * 64 + __builtin_ctzll (_bits); }
+
+      iterator & operator++ (void) {
+        _bits &= _bits - 1;
+        skipEmptyWords();
+        return *this;
+      }
+
+      bool operator== (const iterator & rhs) const { return _word == rhs._word && _bits == rhs._bits; }
+      bool operator!= (const iterator & rhs) const { return ! (*this == rhs); }
+    };
+
+    AdjacentNodes (const uint64_t * words, const std::size_t nWords)
+      : _words (words)
+      , _nWords (nWords) {}
+
+    iterator begin (void) const { return iterator (_words, _nWords, 0); }
+    iterator end (void) const { return iterator (_words, _nWords, _nWords); }
+  };
+
+  // Constructors
+  BitMatrix ()
+    : BitMatrix (0) {}
+
+  // constructs a matrix of the given size without any edge
+  BitMatrix (const unsigned int nNodes)
+    : _nNodes (nNodes)
+    , _nWords ((std::size_t (nNodes) + 63) / 64)
+    , _rows (_nNodes * _nWords, 0)
+    , _cols (_nNodes * _nWords, 0) {}
+
+  // Access-functions
+  inline bool operator() (const unsigned int row, const unsigned int col) const {
+    checkBounds (row);
+    checkBounds (col);
+    return (_rows[row * _nWords + col / 64] >> (col % 64)) & 1;
+  }
+
+  inline void set (const unsigned int row, const unsigned int col, const bool value = true) {
+    checkBounds (row);
+    checkBounds (col);
+
+    const uint64_t rowBit = uint64_t (1) << (col % 64);
+    const uint64_t colBit = uint64_t (1) << (row % 64);
+    if (value) {
+      _rows[row * _nWords + col / 64] |= rowBit;
+      _cols[col * _nWords + row / 64] |= colBit;
+    } else {
+      _rows[row * _nWords + col / 64] &= ~rowBit;
+      _cols[col * _nWords + row / 64] &= ~colBit;
+    }
+  }
+
+  // Functions to access the words of a row or of a column, both have 'nWords' words
+  //
+  // NOTE: The bits behind the last column (row) are always zero.
+  inline const uint64_t * row (const unsigned int row) const {
+    checkBounds (row);
+    return _rows.data() + row * _nWords;
+  }
+
+  inline const uint64_t * col (const unsigned int col) const {
+    checkBounds (col);
+    return _cols.data() + col * _nWords;
+  }
+
+  // Function to give the target nodes of the outgoing edges of a node
+  //
+  // time-complexity:
+  //    O(|V| / 64 + |outgoing edges from nodeId|) ... to iterate over the range
+  AdjacentNodes operator[] (const unsigned int nodeId) const {
+    return AdjacentNodes (row (nodeId), _nWords);
+  }
+
+  // Function to give the number of nodes
+  inline unsigned int nNodes (void) const { return _nNodes; }
+
+  // Function to give the number of 64-bit words of a row
+  inline std::size_t nWords (void) const { return _nWords; }
+
+  // Function to count the ones in a column, which is the amount of incoming edges of a node
+  //
+  // time-complexity:
+  //    O(|V| / 64)
+  unsigned int inDegree (const unsigned int nodeId) const {
+    auto words = col (nodeId);
+
+    unsigned int degree = 0;
+    for (std::size_t i = 0; i < _nWords; i++)
+      degree += __builtin_popcountll (words[i]);
+
+    return degree;
+  }
+
+  // Function to count the ones in a row, which is the amount of outgoing edges of a node
+  //
+  // time-complexity:
+  //    O(|V| / 64)
+  unsigned int outDegree (const unsigned int nodeId) const {
+    auto words = row (nodeId);
+
+    unsigned int degree = 0;
+    for (std::size_t i = 0; i < _nWords; i++)
+      degree += __builtin_popcountll (words[i]);
+
+    return degree;
+  }
+};
+
+#endif
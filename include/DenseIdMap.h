@@ -0,0 +1,204 @@
+#ifndef DENSEIDMAP_H
+#define DENSEIDMAP_H
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "GraphAdjList.h"
+
+// Hash of the keys of a 'DenseIdMap'
+//
+// The hash of the standard library is the identity for integers, so it is mixed [finalizer of
+// MurmurHash3] to spread keys with equal low bits (e.g. multiples of 1024) over the table.
+template <typename Key>
+struct DenseIdHash {
+  inline uint64_t operator() (const Key & key) const {
+    uint64_t hash = std::hash <Key> () (key);
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccd;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53;
+    hash ^= hash >> 33;
+    return hash;
+  }
+};
+
+// This class maps sparse node keys (e.g. 64-bit hashes or names) to dense node-ids
+// [open addressing with linear probing]
+//
+// The ids are given in the order the keys are seen first, so a graph over n different keys
+// has the nodes [0, n) no matter how large the keys are. The keys are kept in a vector
+// indexed by the id, which translates the ids back. Every slot of the table keeps the hash
+// besides the id, so most probes do not touch the keys and growing the table does not hash
+// the keys again. The table has a power of two slots and is at most half full.
+template <typename Key, typename NodeId = unsigned int, typename Hash = DenseIdHash <Key>>
+class DenseIdMap {
+
+  struct Slot {
+    uint64_t hash;
+    NodeId id;
+  };
+
+  static const NodeId EMPTY = std::numeric_limits <NodeId>::max();
+
+  std::vector <Slot> _slots;
+  std::vector <Key> _keys;
+  Hash _hash;
+
+  // Function to give the slot of 'key' or the empty slot, where it would be inserted
+  inline std::size_t findSlot (const Key & key, const uint64_t hash) const {
+    const std::size_t mask = _slots.size() - 1;
+    for (std::size_t slot = hash & mask; ; slot = (slot + 1) & mask)
+      if (_slots[slot].id == EMPTY || (_slots[slot].hash == hash && _keys[_slots[slot].id] == key))
+        return slot;
+  }
+
+  // Function to resize the table to 'nSlots' slots, which has to be a power of two
+  void rehash (const std::size_t nSlots) {
+    std::vector <Slot> slots (nSlots, Slot {0, EMPTY});
+    const std::size_t mask = nSlots - 1;
+
+    for (auto & oldSlot : _slots) {
+      if (oldSlot.id == EMPTY)
+        continue;
+
+      std::size_t slot = oldSlot.hash & mask;
+      while (slots[slot].id != EMPTY)
+        slot = (slot + 1) & mask;
+      slots[slot] = oldSlot;
+    }
+
+    _slots.swap (slots);
+  }
+
+public:
+
+  // Constructor
+  DenseIdMap (const std::size_t nKeys = 0) {
+    reserve (nKeys);
+  }
+
+  // Function to make room for 'nKeys' keys without growing the table
+  void reserve (const std::size_t nKeys) {
+    std::size_t nSlots = 16;
+    while (nSlots < 2 * nKeys)
+      nSlots *= 2;
+
+    if (nSlots > _slots.size())
+      rehash (nSlots);
+    _keys.reserve (nKeys);
+  }
+
+  // Function to give the id of a key, a new key gets the next unused id
+  //
+  // NOTE: An exception is thrown, if the amount of keys does not fit into 'NodeId'.
+  //
+  // time-complexity:
+  //      O(1) ... expected and amortized
+  NodeId insert (const Key & key) {
+    if (2 * (_keys.size() + 1) > _slots.size())
+      rehash (2 * _slots.size());
+
+    const uint64_t hash = _hash (key);
+    auto & slot = _slots[findSlot (key, hash)];
+    if (slot.id != EMPTY)
+      return slot.id;
+
+    // NOTE: Like for the graphs, the amount of nodes has to fit into 'NodeId'.
+    if (_keys.size() >= std::size_t (EMPTY))
+      throw std::invalid_argument ("The amount of node keys does not fit into the node-id type.");
+
+    slot = Slot {hash, NodeId (_keys.size())};
+    _keys.push_back (key);
+    return slot.id;
+  }
+
+  // Function to determine the id of a key, returns false if the key is not known
+  //
+  // time-complexity:
+  //      O(1) ... expected
+  bool find (const Key & key, NodeId & id) const {
+    if (_slots.empty())
+      return false;
+
+    const auto & slot = _slots[findSlot (key, _hash (key))];
+    id = slot.id;
+    return slot.id != EMPTY;
+  }
+
+  // Function to give the key of an id
+  inline const Key & key (const NodeId id) const {
+    if (id >= _keys.size())
+      throw std::invalid_argument ("Array index out of bounds.");
+    return _keys[id];
+  }
+
+  // Function to give all keys, indexed by their id
+  inline const std::vector <Key> & keys (void) const {
+    return _keys;
+  }
+
+  // Function to give the amount of keys, which is the amount of nodes of the graph
+  inline std::size_t size (void) const {
+    return _keys.size();
+  }
+
+  // Function to map edges between keys to edges between dense node-ids
+  //
+  // time-complexity:
+  //      O(|E|) ... expected
+  std::vector <BasicEdge <NodeId>> insertEdges (const std::vector <std::pair <Key, Key>> & edges) {
+    std::vector <BasicEdge <NodeId>> denseEdges;
+    denseEdges.reserve (edges.size());
+
+    for (auto & edge : edges) {
+      // NOTE: The source node is inserted first, so the ids follow the order of the file.
+      auto sourceNodeId = insert (edge.first);
+      denseEdges.push_back (BasicEdge <NodeId> (sourceNodeId, insert (edge.second)));
+    }
+
+    return denseEdges;
+  }
+
+  // Function to translate node-ids (e.g. a sorting) back to their keys
+  //
+  // time-complexity:
+  //      O(|nodeIds|)
+  std::vector <Key> translate (const std::vector <NodeId> & nodeIds) const {
+    std::vector <Key> keys;
+    keys.reserve (nodeIds.size());
+
+    for (auto nodeId : nodeIds)
+      keys.push_back (key (nodeId));
+
+    return keys;
+  }
+};
+
+// FUNCTIONS TO READ GRAPHS WITH SPARSE NODE KEYS
+// Function to read directed edges with arbitrary 64-bit node keys from a file
+//
+// The file has the same format as for 'readEdgesFromFile', but the keys may use all 64 bits.
+// Every key is mapped to a dense node-id using 'ids', so 'createGraphCSRFromEdges' gives a
+// graph with one node per key. Like 'parseEdges' the parsing stops at the first token, which
+// is not a valid key.
+//
+// time-complexity:
+//      O(|E|) ... expected
+std::vector <Edge> readEdgesWithSparseIdsFromFile (const std::string & filename, DenseIdMap <uint64_t> & ids);
+
+// Function to read directed edges with string node keys (e.g. names of jobs) from a file
+//
+// Every line holds the keys of the source and the target node, separated by WHITESPACE. A key
+// is any sequence of other characters. A last source key without target key is ignored.
+//
+// time-complexity:
+//      O(|E| + size of the file) ... expected
+std::vector <Edge> readEdgesWithKeysFromFile (const std::string & filename, DenseIdMap <std::string> & ids);
+
+#endif
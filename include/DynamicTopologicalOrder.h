@@ -0,0 +1,83 @@
+#ifndef DYNAMICTOPOLOGICALORDER_H
+#define DYNAMICTOPOLOGICALORDER_H
+
+#include <vector>
+
+#include "GraphAdjList.h"
+
+// This class keeps a topological sorting of a DAG up to date, while edges are inserted and
+// deleted [Pearce-Kelly algorithm]
+//
+// Inserting an edge (x, y) with x already sorted before y does not change the sorting.
+// Otherwise only the nodes between y and x in the current sorting are searched: the nodes
+// reachable from y and the nodes reaching x are collected and moved, keeping their relative
+// order, into the positions they occupied together. If x is reachable from y, the edge would
+// close a cycle and it is rejected. Deleting an edge never invalidates the sorting.
+class DynamicTopologicalOrder {
+
+  // adjacency lists of the outgoing and of the ingoing edges
+  GraphAdjList _posDag;
+  GraphAdjList _negDag;
+
+  // current sorting (position -> node) and its inverse (node -> position)
+  std::vector <unsigned int> _order;
+  std::vector <unsigned int> _position;
+
+  // buffers for the searches, they are kept to avoid allocations for every insertion
+  std::vector <bool> _visited;
+  std::vector <unsigned int> _forwardNodes;
+  std::vector <unsigned int> _backwardNodes;
+  std::vector <unsigned int> _stack;
+  std::vector <unsigned int> _positions;
+
+  // Function to collect all unvisited nodes reachable from 'sourceNodeId' (following the edges
+  // of 'dag'), which have a position in (lowerBound, upperBound). Returns false, if a node at
+  // position 'stopPosition' has been reached.
+  bool collectNodes (const GraphAdjList & dag, const unsigned int sourceNodeId
+                   , const unsigned int lowerBound, const unsigned int upperBound
+                   , const unsigned int stopPosition, std::vector <unsigned int> & nodes);
+
+public:
+
+  // Constructor
+  //
+  // The initial sorting is computed from scratch, an exception is thrown if 'dag' contains a
+  // cycle.
+  //
+  // time-complexity:
+  //    O(|V| + |E|)
+  DynamicTopologicalOrder (const GraphAdjList & dag);
+
+  // Function to insert an edge and to repair the sorting
+  //
+  // Returns false and leaves graph and sorting unchanged, if the edge would close a cycle.
+  //
+  // time-complexity:
+  //    O(1) ... if e.first is already sorted before e.second
+  //    O(|affected nodes| * log(|affected nodes|) + |edges of the affected nodes|) ... else
+  bool insertEdge (const Edge & e);
+
+  // Function to delete an edge
+  //
+  // time-complexity:
+  //    O(|outgoing edges from e.first| + |incoming edges to e.second|)
+  void deleteEdge (const Edge & e);
+
+  // Function to give the current sorting
+  const std::vector <unsigned int> & order (void) const { return _order; }
+
+  // Function to give the position of a node within the current sorting
+  unsigned int position (const unsigned int nodeId) const {
+    if (nodeId >= _position.size())
+      throw std::invalid_argument ("Array index out of bounds.");
+    return _position[nodeId];
+  }
+
+  // Function to give the graph
+  const GraphAdjList & graph (void) const { return _posDag; }
+
+  // Function to give the number of nodes
+  unsigned int nNodes (void) const { return _posDag.nNodes(); }
+};
+
+#endif
@@ -1,4 +1,9 @@
+#ifndef GRAPHADJLIST_H
+#define GRAPHADJLIST_H
+
 #include <forward_list>
+#include <iterator>
+#include <memory>
 #include <vector>
 
 // use hashes instead of lists, associative array
@@ -6,24 +11,50 @@
 // 25.2, 11:30Uhr 
 
 #include "matrix.h"
+#include "NodePool.h"
 typedef Matrix <bool> Graph; 
-typedef std::pair <unsigned int, unsigned int> Edge;
+
+// directed edge (source node, target node)
+template <typename NodeId>
+using BasicEdge = std::pair <NodeId, NodeId>;
+
+typedef BasicEdge <unsigned int> Edge;
 
 enum struct NodeColor {UNMARKED, TEMPORARILY_MARKED, PERMANENTLY_MARKED};
 
 // This class can be used to represent a graph as a adjacency list
-class GraphAdjList {
+//
+// The nodes of all lists are taken from one 'NodePool' per graph, so building, copying and
+// destroying a graph needs a few large allocations instead of one per edge, and graphs built
+// by different threads do not compete for the global heap. Several graphs can share a pool, if
+// they are used by the same thread.
+//
+// The type of the node-ids is a template parameter, a graph with 'NodeId' can have at most
+// std::numeric_limits <NodeId>::max() nodes. 'GraphAdjList' uses 'unsigned int'.
+template <typename NodeId>
+class BasicGraphAdjList {
+
+public:
+  
+  typedef NodeId NodeIdType;
+  typedef std::forward_list <NodeId, PoolAllocator <NodeId>> AdjacencyList;
+
+private:
   
+  // pool of the nodes of the lists
+  // NOTE: The allocators of the lists only point to the pool, the graph keeps it alive. It is
+  //       declared before the lists, so it is destroyed after them.
+  std::shared_ptr <NodePool> _pool;
   // adjacency list
-  std::vector <std::forward_list <unsigned int>> _data;
+  std::vector <AdjacencyList> _data;
   // node colors 
   std::vector <NodeColor> _nodeColors;
   
   // keep track of the amount of nodes and edges
-  const unsigned int _nNodes;
+  const std::size_t _nNodes;
   
   // function to check, whether a given node id is valid 
-  inline void checkBounds (unsigned int nodeId) const {
+  inline void checkBounds (NodeId nodeId) const {
     if (nodeId >= _data.size())
       throw std::invalid_argument ("Array index out of bounds.");
   }
@@ -31,45 +62,71 @@ class GraphAdjList {
 public:
   
   // Constructors
-  GraphAdjList () 
-    : _nNodes (0)
+  BasicGraphAdjList () 
+    : _pool (std::make_shared <NodePool> ())
+    , _nNodes (0)
+  {}
+  
+  // NOTE: 'pool' allows to share the pool with other graphs, by default every graph gets its
+  //       own pool.
+  BasicGraphAdjList (const std::size_t nNodes, std::shared_ptr <NodePool> pool = std::make_shared <NodePool> ()) 
+    : _pool (std::move (pool))
+    , _data (nNodes, AdjacencyList (PoolAllocator <NodeId> (_pool.get())))
+    , _nodeColors (nNodes, NodeColor::UNMARKED)
+    , _nNodes (nNodes)
+  {}
+  
+  // Copy-constructor, the copy gets its own pool
+  //
+  // time-complexity:
+  //      O(|V| + |E|)
+  BasicGraphAdjList (const BasicGraphAdjList & graph)
+    : _pool (std::make_shared <NodePool> ())
+    , _nodeColors (graph._nodeColors)
+    , _nNodes (graph._nNodes)
   {
-    _data = std::vector <std::forward_list <unsigned int>> ();
-    _nodeColors = std::vector <NodeColor> ();
+    std::size_t nEdges = 0;
+    for (auto & adjacencyList : graph._data)
+      nEdges += std::distance (adjacencyList.begin(), adjacencyList.end());
+    _pool -> reserve (nEdges);
+    
+    _data.reserve (graph._data.size());
+    for (auto & adjacencyList : graph._data)
+      _data.push_back (AdjacencyList (adjacencyList.begin(), adjacencyList.end(), PoolAllocator <NodeId> (_pool.get())));
   }
   
-  GraphAdjList (const unsigned int nNodes) 
-    : _nNodes (nNodes)
-  {
-    _data = std::vector <std::forward_list <unsigned int>> (nNodes);
-    _nodeColors = std::vector <NodeColor> (nNodes, NodeColor::UNMARKED);
-  }
+  BasicGraphAdjList (BasicGraphAdjList &&) = default;
   
   // Access-operators
-  std::forward_list <unsigned int> & operator[] (const unsigned int nodeId) {
+  AdjacencyList & operator[] (const NodeId nodeId) {
     checkBounds (nodeId);
     return this -> _data[nodeId];
   }
   
-  const std::forward_list <unsigned int> & operator[] (const unsigned int nodeId) const {
+  const AdjacencyList & operator[] (const NodeId nodeId) const {
     checkBounds (nodeId);
     return this -> _data[nodeId];
   }
   
   // iterators
-  std::vector <std::forward_list <unsigned int>>::iterator begin (void) { return _data.begin(); }
-  std::vector <std::forward_list <unsigned int>>::iterator end (void) { return _data.end(); }
+  typename std::vector <AdjacencyList>::iterator begin (void) { return _data.begin(); }
+  typename std::vector <AdjacencyList>::iterator end (void) { return _data.end(); }
   
-  std::vector <std::forward_list <unsigned int>>::const_iterator begin (void) const { return _data.begin(); }
-  std::vector <std::forward_list <unsigned int>>::const_iterator end (void) const { return _data.end(); }
+  typename std::vector <AdjacencyList>::const_iterator begin (void) const { return _data.begin(); }
+  typename std::vector <AdjacencyList>::const_iterator end (void) const { return _data.end(); }
+  
+  // Function to give the pool of the nodes of the lists
+  inline const std::shared_ptr <NodePool> & pool (void) const {
+    return _pool;
+  }
   
   // access and set the node colors
-  inline NodeColor getNodeColor (const unsigned int nodeId) const {
+  inline NodeColor getNodeColor (const NodeId nodeId) const {
     checkBounds (nodeId);
     return _nodeColors[nodeId];
   }
   
-  inline void setNodeColor (const unsigned int nodeId, const NodeColor newNodeColor) {
+  inline void setNodeColor (const NodeId nodeId, const NodeColor newNodeColor) {
     checkBounds (nodeId);
     _nodeColors[nodeId] = newNodeColor;
   }
@@ -78,7 +135,7 @@ public:
   // 
   // time-complexity:
   //    O(|E|)
-  bool containsEdge (const Edge & e) const {
+  bool containsEdge (const BasicEdge <NodeId> & e) const {
     checkBounds (e.first);
     checkBounds (e.second);
     
@@ -95,7 +152,7 @@ public:
   //
   // time-complexity:
   //    O(|outgoing edges from e.first|)
-  void deleteEdge (const Edge & e) {
+  void deleteEdge (const BasicEdge <NodeId> & e) {
     checkBounds (e.first);
     checkBounds (e.second);
     _data[e.first].remove (e.second); 
@@ -104,7 +161,7 @@ public:
   // time-complexity:
   //    O(1) ... if 'removeDoubleEdges' is false
   //    O(|outgoing edges from e.first|) ... else
-  void insertEdge (const Edge & e, const bool removeDoubleEdges = true) {
+  void insertEdge (const BasicEdge <NodeId> & e, const bool removeDoubleEdges = true) {
     checkBounds (e.first);
     checkBounds (e.second);
     _data[e.first].push_front (e.second);
@@ -126,7 +183,7 @@ public:
   }
  
   // Function to give the number of nodes in the adjacency list
-  inline unsigned int nNodes (void) const {
+  inline std::size_t nNodes (void) const {
     return _nNodes;
   }
   
@@ -135,7 +192,7 @@ public:
     if (! ostream.good())
       throw std::invalid_argument ("Output-stream is not good.");
     
-    for (unsigned int sourceNodeId = 0; sourceNodeId < (this -> nNodes()); sourceNodeId++) {
+    for (std::size_t sourceNodeId = 0; sourceNodeId < (this -> nNodes()); sourceNodeId++) {
       if (_data[sourceNodeId].empty()) {
         ostream << sourceNodeId << " NULL" << std::endl;
         continue;
@@ -148,4 +205,8 @@ public:
         ostream << sourceNodeId << " " << *targetNode << std::endl;
     }
   }
-};
\ No newline at end of file
+};
+
+typedef BasicGraphAdjList <unsigned int> GraphAdjList;
+
+#endif
@@ -0,0 +1,138 @@
+#ifndef GRAPHCSR_H
+#define GRAPHCSR_H
+
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+// This class can be used to represent a graph in the compressed sparse row (CSR) format
+//
+// The targets of all edges are stored in one contiguous array, grouped by their source
+// node. The outgoing edges of node n are found at the positions [offsets[n], offsets[n + 1])
+// of the target array. Therefore walking the adjacency of a node does not chase any
+// pointers and building the graph needs two allocations only.
+//
+// The type of the node-ids is a template parameter, a graph with 'NodeId' can have at most
+// std::numeric_limits <NodeId>::max() nodes. 'GraphCSR' uses 'unsigned int'.
+//
+// NOTE: The graph is immutable. Use 'createGraphCSRFromEdges' to create one.
+template <typename NodeId>
+class BasicGraphCSR {
+
+  // position of the first outgoing edge of each node, the last element is |E|
+  std::vector <std::size_t> _offsets;
+  // target nodes of all edges, ordered by their source node
+  std::vector <NodeId> _targets;
+
+  // function to check, whether a given node id is valid
+  inline void checkBounds (NodeId nodeId) const {
+    if (nodeId >= nNodes())
+      throw std::invalid_argument ("Array index out of bounds.");
+  }
+
+public:
+
+  typedef NodeId NodeIdType;
+
+  // Range over the target nodes of the outgoing edges of a single node
+  class AdjacentNodes {
+    const NodeId * _bgn;
+    const NodeId * _end;
+
+  public:
+    AdjacentNodes (const NodeId * bgn, const NodeId * end)
+      : _bgn (bgn)
+      , _end (end) {}
+
+    const NodeId * begin (void) const { return _bgn; }
+    const NodeId * end (void) const { return _end; }
+
+    bool empty (void) const { return _bgn == _end; }
+    std::size_t size (void) const { return _end - _bgn; }
+  };
+
+  // Constructors
+  BasicGraphCSR ()
+    : _offsets (1, 0) {}
+
+  // constructor _move_ the offsets and targets into the graph
+  //
+  // NOTE: 'offsets' needs to have |V| + 1 non-decreasing elements, starting with 0 and
+  //       ending with |E|.
+  BasicGraphCSR (std::vector <std::size_t> && offsets, std::vector <NodeId> && targets)
+    : _offsets (std::move (offsets))
+    , _targets (std::move (targets))
+  {
+    if (_offsets.empty() || _offsets.front() != 0 || _offsets.back() != _targets.size())
+      throw std::invalid_argument ("Offsets of the CSR graph do not fit to the targets.");
+  }
+
+  // Access-operator
+  AdjacentNodes operator[] (const NodeId nodeId) const {
+    checkBounds (nodeId);
+    return AdjacentNodes (_targets.data() + _offsets[nodeId], _targets.data() + _offsets[nodeId + 1]);
+  }
+
+  // access the raw arrays
+  const std::vector <std::size_t> & offsets (void) const { return _offsets; }
+  const std::vector <NodeId> & targets (void) const { return _targets; }
+
+  // Function to determine, whether is given edge is within the graph
+  //
+  // time-complexity:
+  //    O(|outgoing edges from e.first|)
+  bool containsEdge (const std::pair <NodeId, NodeId> & e) const {
+    checkBounds (e.first);
+    checkBounds (e.second);
+
+    for (auto targetNodeId : (*this)[e.first])
+      if (targetNodeId == e.second)
+        return true;
+
+    return false;
+  }
+
+  // Function which returns true, if no edge is in the graph
+  // time-complexity:
+  //    O(1)
+  inline bool isEmpty (void) const {
+    return _targets.empty();
+  }
+
+  // Function to give the number of nodes in the graph
+  inline std::size_t nNodes (void) const {
+    return _offsets.size() - 1;
+  }
+
+  // Function to give the number of edges in the graph
+  inline std::size_t nEdges (void) const {
+    return _targets.size();
+  }
+
+  // Function to give the number of outgoing edges of a node
+  inline std::size_t outDegree (const NodeId nodeId) const {
+    checkBounds (nodeId);
+    return _offsets[nodeId + 1] - _offsets[nodeId];
+  }
+
+  // Function to output the graph to an output stream
+  void printGraph (std::ostream & ostream = std::cout) const {
+    if (! ostream.good())
+      throw std::invalid_argument ("Output-stream is not good.");
+
+    for (std::size_t sourceNodeId = 0; sourceNodeId < nNodes(); sourceNodeId++) {
+      if (outDegree (sourceNodeId) == 0) {
+        ostream << sourceNodeId << " NULL" << std::endl;
+        continue;
+      }
+
+      for (auto targetNodeId : (*this)[sourceNodeId])
+        ostream << sourceNodeId << " " << targetNodeId << std::endl;
+    }
+  }
+};
+
+typedef BasicGraphCSR <unsigned int> GraphCSR;
+
+#endif
@@ -0,0 +1,255 @@
+#ifndef GRAPHCOMPRESSED_H
+#define GRAPHCOMPRESSED_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+// This class can be used to represent a graph with compressed adjacency lists [delta + varint]
+//
+// Like in the compressed sparse row format the adjacency lists of all nodes are stored one
+// after the other in a single array, but as bytes: the targets of a node are sorted and only
+// the differences between them are stored as variable length integers (7 bits per byte, the
+// highest bit tells, whether another byte follows). The first target is stored as difference
+// to the source node (zig-zag encoded, so it may be smaller). Graphs with local ids need 1-2
+// bytes per edge instead of sizeof (NodeId).
+//
+// The end of the adjacency of every node is kept as 32-bit offset relative to the first byte of
+// its block of 64 nodes, so a node needs 4 bytes instead of the 8 bytes of a CSR offset.
+//
+// The targets are decoded on the fly, while iterating 'graph[n]', so the sorting algorithms
+// run directly on the compressed graph. Decoding costs time, so the CSR format is faster as
+// long as the graph fits into memory.
+//
+// NOTE: The graph is immutable. Use 'createGraphCompressedFromEdges' to create one. The
+//       targets of every node are given in increasing order, not in the order of the edges.
+template <typename NodeId>
+class BasicGraphCompressed {
+
+  static const unsigned int BLOCK_SIZE = 64;
+
+  // position of the first byte of the outgoing edges of every block of 'BLOCK_SIZE' nodes
+  std::vector <std::size_t> _blockOffsets;
+  // position behind the last byte of the outgoing edges of each node, relative to its block
+  std::vector <uint32_t> _ends;
+  // encoded targets of all edges, ordered by their source node
+  // NOTE: A zero byte is appended, so decoding behind the last target stays within the array.
+  std::vector <uint8_t> _bytes;
+  std::size_t _nEdges;
+
+  // function to check, whether a given node id is valid
+  inline void checkBounds (NodeId nodeId) const {
+    if (nodeId >= nNodes())
+      throw std::invalid_argument ("Array index out of bounds.");
+  }
+
+public:
+
+  typedef NodeId NodeIdType;
+
+  // Function to decode the variable length integer at 'it' and to give the position behind it
+  static inline const uint8_t * decodeVarint (const uint8_t * it, uint64_t & value) {
+    value = *it & 0x7f;
+    for (unsigned int shift = 7; *it & 0x80; shift += 7)
+      value |= uint64_t (*(++it) & 0x7f) << shift;
+    return it + 1;
+  }
+
+  // Function to append the variable length integer 'value' to 'bytes'
+  static inline void encodeVarint (uint64_t value, std::vector <uint8_t> & bytes) {
+    while (value >= 0x80) {
+      bytes.push_back (uint8_t (value) | 0x80);
+      value >>= 7;
+    }
+    bytes.push_back (uint8_t (value));
+  }
+
+  // Functions to map the signed difference of the first target to the source node to an
+  // unsigned integer and back [zig-zag encoding]
+  static inline uint64_t encodeFirstTarget (const NodeId sourceNodeId, const NodeId targetNodeId) {
+    const uint64_t delta = uint64_t (targetNodeId) - uint64_t (sourceNodeId);
+    return (delta << 1) ^ (0 - (delta >> 63));
+  }
+
+  static inline NodeId decodeFirstTarget (const NodeId sourceNodeId, const uint64_t value) {
+    return NodeId (uint64_t (sourceNodeId) + ((value >> 1) ^ (0 - (value & 1))));
+  }
+
+  // Iterator over the target nodes of a single node, which decodes one target per step
+  class const_iterator {
+    // position of the current target, the next target and the current target itself
+    const uint8_t * _pos;
+    const uint8_t * _next;
+    NodeId _nodeId;
+
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef NodeId value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const NodeId * pointer;
+    typedef const NodeId & reference;
+
+    // iterator at the end of an adjacency
+    const_iterator (const uint8_t * end)
+      : _pos (end)
+      , _next (end)
+      , _nodeId (0) {}
+
+    // iterator at the first target of the adjacency of 'sourceNodeId'
+    const_iterator (const uint8_t * bgn, const NodeId sourceNodeId)
+      : _pos (bgn)
+    {
+      uint64_t value;
+      _next = decodeVarint (bgn, value);
+      _nodeId = decodeFirstTarget (sourceNodeId, value);
+    }
+
+    inline const NodeId & operator* (void) const { return _nodeId; }
+
+    // NOTE: Behind the last target the next adjacency (or the appended zero byte) is decoded,
+    //       the result is never used.
+    inline const_iterator & operator++ (void) {
+      uint64_t delta;
+      _pos = _next;
+      _next = decodeVarint (_pos, delta);
+      _nodeId = NodeId (_nodeId + delta);
+      return *this;
+    }
+
+    inline const_iterator operator++ (int) {
+      auto it = *this;
+      ++(*this);
+      return it;
+    }
+
+    inline bool operator== (const const_iterator & it) const { return _pos == it._pos; }
+    inline bool operator!= (const const_iterator & it) const { return _pos != it._pos; }
+  };
+
+  // Range over the target nodes of the outgoing edges of a single node
+  class AdjacentNodes {
+    const uint8_t * _bgn;
+    const uint8_t * _end;
+    NodeId _sourceNodeId;
+
+  public:
+    AdjacentNodes (const uint8_t * bgn, const uint8_t * end, const NodeId sourceNodeId)
+      : _bgn (bgn)
+      , _end (end)
+      , _sourceNodeId (sourceNodeId) {}
+
+    const_iterator begin (void) const { return _bgn == _end ? const_iterator (_end) : const_iterator (_bgn, _sourceNodeId); }
+    const_iterator end (void) const { return const_iterator (_end); }
+
+    bool empty (void) const { return _bgn == _end; }
+  };
+
+  // Constructors
+  BasicGraphCompressed ()
+    : _bytes (1, 0)
+    , _nEdges (0) {}
+
+  // constructor _move_ the offsets and the encoded targets into the graph
+  //
+  // NOTE: 'offsets' needs to have |V| + 1 non-decreasing elements, starting with 0 and
+  //       ending with the size of 'bytes'. Every node needs its targets in increasing order
+  //       encoded like described above. The adjacencies of a block of 64 nodes need to be
+  //       smaller than 4 GiB.
+  BasicGraphCompressed (const std::vector <std::size_t> & offsets, std::vector <uint8_t> && bytes, const std::size_t nEdges)
+    : _bytes (std::move (bytes))
+    , _nEdges (nEdges)
+  {
+    if (offsets.empty() || offsets.front() != 0 || offsets.back() != _bytes.size())
+      throw std::invalid_argument ("Offsets of the compressed graph do not fit to the encoded targets.");
+
+    const std::size_t nNodes = offsets.size() - 1;
+    _ends.resize (nNodes);
+    _blockOffsets.resize ((nNodes + BLOCK_SIZE - 1) / BLOCK_SIZE);
+    for (std::size_t nodeId = 0; nodeId < nNodes; nodeId++) {
+      const std::size_t blockOffset = offsets[nodeId / BLOCK_SIZE * BLOCK_SIZE];
+      if (offsets[nodeId + 1] - blockOffset > std::numeric_limits <uint32_t>::max())
+        throw std::invalid_argument ("The adjacencies of a block of the compressed graph are too large.");
+
+      _blockOffsets[nodeId / BLOCK_SIZE] = blockOffset;
+      _ends[nodeId] = offsets[nodeId + 1] - blockOffset;
+    }
+
+    _bytes.push_back (0);
+  }
+
+  // Access-operator
+  AdjacentNodes operator[] (const NodeId nodeId) const {
+    checkBounds (nodeId);
+    const uint8_t * block = _bytes.data() + _blockOffsets[nodeId / BLOCK_SIZE];
+    const uint32_t bgn = nodeId % BLOCK_SIZE == 0 ? 0 : _ends[nodeId - 1];
+    return AdjacentNodes (block + bgn, block + _ends[nodeId], nodeId);
+  }
+
+  // access the encoded targets
+  const std::vector <uint8_t> & bytes (void) const { return _bytes; }
+
+  // Function to determine, whether is given edge is within the graph
+  //
+  // time-complexity:
+  //    O(|outgoing edges from e.first|)
+  bool containsEdge (const std::pair <NodeId, NodeId> & e) const {
+    checkBounds (e.first);
+    checkBounds (e.second);
+
+    // the targets are sorted
+    for (auto targetNodeId : (*this)[e.first]) {
+      if (targetNodeId == e.second)
+        return true;
+      if (targetNodeId > e.second)
+        return false;
+    }
+
+    return false;
+  }
+
+  // Function which returns true, if no edge is in the graph
+  // time-complexity:
+  //    O(1)
+  inline bool isEmpty (void) const {
+    return _nEdges == 0;
+  }
+
+  // Function to give the number of nodes in the graph
+  inline std::size_t nNodes (void) const {
+    return _ends.size();
+  }
+
+  // Function to give the number of edges in the graph
+  inline std::size_t nEdges (void) const {
+    return _nEdges;
+  }
+
+  // Function to give the memory used by the offsets and the encoded targets in bytes
+  inline std::size_t nBytes (void) const {
+    return _blockOffsets.size() * sizeof (std::size_t) + _ends.size() * sizeof (uint32_t) + _bytes.size();
+  }
+
+  // Function to output the graph to an output stream
+  void printGraph (std::ostream & ostream = std::cout) const {
+    if (! ostream.good())
+      throw std::invalid_argument ("Output-stream is not good.");
+
+    for (std::size_t sourceNodeId = 0; sourceNodeId < nNodes(); sourceNodeId++) {
+      if ((*this)[sourceNodeId].empty()) {
+        ostream << sourceNodeId << " NULL" << std::endl;
+        continue;
+      }
+
+      for (auto targetNodeId : (*this)[sourceNodeId])
+        ostream << sourceNodeId << " " << targetNodeId << std::endl;
+    }
+  }
+};
+
+typedef BasicGraphCompressed <unsigned int> GraphCompressed;
+
+#endif
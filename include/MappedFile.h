@@ -0,0 +1,145 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// This class maps a whole file read-only into memory
+//
+// The content can be accessed like a character array, without copying it into a buffer
+// first. The mapping is released, when the object is destroyed.
+class MappedFile {
+
+  const char * _data;
+  std::size_t _size;
+
+public:
+
+  // Constructor
+  //
+  // NOTE: Empty files are not mapped at all, 'data' returns a null pointer for them.
+  MappedFile (const std::string & filename, const bool sequentialAccess = true)
+    : _data (nullptr)
+    , _size (0)
+  {
+    int fd = open (filename.c_str(), O_RDONLY);
+    if (fd < 0)
+      throw std::invalid_argument ("Cannot open file: " + filename);
+
+    struct stat fileStatus;
+    if (fstat (fd, &fileStatus) != 0) {
+      close (fd);
+      throw std::runtime_error ("Cannot determine the size of file: " + filename);
+    }
+    _size = fileStatus.st_size;
+
+    if (_size > 0) {
+      void * data = mmap (nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED) {
+        close (fd);
+        throw std::runtime_error ("Cannot map file into memory: " + filename);
+      }
+
+      // tell the kernel to read ahead aggressively
+      if (sequentialAccess)
+        madvise (data, _size, MADV_SEQUENTIAL);
+
+      _data = static_cast <const char *> (data);
+    }
+
+    // NOTE: The mapping stays valid after closing the file descriptor.
+    close (fd);
+  }
+
+  ~MappedFile () {
+    if (_data)
+      munmap (const_cast <char *> (_data), _size);
+  }
+
+  // a mapping can not be copied
+  MappedFile (const MappedFile &) = delete;
+  MappedFile & operator= (const MappedFile &) = delete;
+
+  // Access to the mapped content
+  const char * data (void) const { return _data; }
+  const char * begin (void) const { return _data; }
+  const char * end (void) const { return _data + _size; }
+
+  std::size_t size (void) const { return _size; }
+};
+
+// Function to give the amount of lines in [bgn, end), a last line without NEWLINE included
+//
+// Every edge needs its own line in the usual files, so the amount of lines is a good guess
+// for the amount of edges.
+// NOTE: 'memchr' is much faster than parsing, so this pass is cheap.
+inline std::size_t countLines (const char * bgn, const char * end) {
+  std::size_t nLines = 1;
+  for (auto it = bgn; it != end; nLines++) {
+    it = static_cast <const char *> (std::memchr (it, '\n', end - it));
+    if (! it)
+      break;
+    ++it;
+  }
+  return nLines;
+}
+
+// Function to check for WHITESPACE and NEWLINE
+inline bool isWhitespace (const char c) {
+  return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+// Function to skip WHITESPACE and NEWLINE
+inline void skipWhitespace (const char * & it, const char * end) {
+  while (it != end && isWhitespace (*it))
+    ++it;
+}
+
+// Function to give the next token of [it, end), which is separated by WHITESPACE or NEWLINE,
+// and to move 'it' behind it, returns false if there is no token left
+inline bool nextToken (const char * & it, const char * end, const char * & tokenBgn, const char * & tokenEnd) {
+  skipWhitespace (it, end);
+  if (it == end)
+    return false;
+
+  tokenBgn = it;
+  while (it != end && ! isWhitespace (*it))
+    ++it;
+  tokenEnd = it;
+
+  return true;
+}
+
+// Function to parse the decimal number at 'it' and to move 'it' behind it, returns false if
+// there is no number or if it does not fit into 'Number'
+template <typename Number>
+inline bool parseNumber (const char * & it, const char * end, Number & number) {
+  const Number maxQuotient = std::numeric_limits <Number>::max() / 10;
+  const Number maxRemainder = std::numeric_limits <Number>::max() % 10;
+
+  if (it == end || *it < '0' || *it > '9')
+    return false;
+
+  Number value = 0;
+  do {
+    const Number digit = *it - '0';
+    // too large for 'Number'
+    if (value > maxQuotient || (value == maxQuotient && digit > maxRemainder))
+      return false;
+    value = value * 10 + digit;
+    ++it;
+  } while (it != end && *it >= '0' && *it <= '9');
+
+  number = value;
+  return true;
+}
+
+#endif
@@ -0,0 +1,181 @@
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+// This class is a pool of equally sized memory blocks [slab allocator]
+//
+// The blocks are cut from slabs, which get larger with every slab, so building a graph with
+// |E| nodes of lists needs O(log(|E|)) allocations instead of |E|. Freed blocks are kept in a
+// list and reused. The slabs are only released, when the pool is destroyed.
+//
+// The size of the blocks is set by the first allocation, larger requests (e.g. of arrays) are
+// passed to 'operator new'.
+// NOTE: The pool is not thread-safe, every thread should use its own pool.
+class NodePool {
+
+  // a free block stores the pointer to the next free block
+  struct FreeBlock {
+    FreeBlock * next;
+  };
+
+  std::size_t _blockSize;
+  std::vector <std::unique_ptr <char[]>> _slabs;
+  FreeBlock * _freeBlocks;
+
+  // unused part of the last slab
+  char * _slabBgn;
+  char * _slabEnd;
+
+  // amount of blocks of the next slab
+  std::size_t _nextSlabSize;
+
+  void addSlab (void) {
+    const std::size_t maxSlabSize = std::size_t (1) << 16;
+
+    _slabs.push_back (std::unique_ptr <char[]> (new char[_nextSlabSize * _blockSize]));
+    _slabBgn = _slabs.back().get();
+    _slabEnd = _slabBgn + _nextSlabSize * _blockSize;
+
+    _nextSlabSize = std::max (_nextSlabSize, std::min (2 * _nextSlabSize, maxSlabSize));
+  }
+
+public:
+
+  // Constructor
+  NodePool (const std::size_t firstSlabSize = 256)
+    : _blockSize (0)
+    , _freeBlocks (nullptr)
+    , _slabBgn (nullptr)
+    , _slabEnd (nullptr)
+    , _nextSlabSize (std::max <std::size_t> (1, firstSlabSize))
+  {}
+
+  NodePool (const NodePool &) = delete;
+  NodePool & operator= (const NodePool &) = delete;
+
+  // Function to make room for 'nBlocks' more blocks within a single slab
+  //
+  // NOTE: The rest of the current slab is not used anymore, if it is too small.
+  void reserve (const std::size_t nBlocks) {
+    if (_blockSize != 0 && std::size_t (_slabEnd - _slabBgn) >= nBlocks * _blockSize)
+      return;
+
+    _nextSlabSize = std::max (_nextSlabSize, nBlocks);
+    if (_blockSize != 0)
+      addSlab();
+  }
+
+  // Function to give a block of at least 'size' bytes
+  //
+  // time-complexity:
+  //      O(1) ... amortized
+  void * allocate (const std::size_t size) {
+    // the blocks are aligned like 'operator new' does it, so they fit every node type
+    if (_blockSize == 0) {
+      const std::size_t alignment = alignof (std::max_align_t);
+      _blockSize = (std::max (size, sizeof (FreeBlock)) + alignment - 1) / alignment * alignment;
+    }
+
+    if (size > _blockSize)
+      return ::operator new (size);
+
+    if (_freeBlocks) {
+      auto block = _freeBlocks;
+      _freeBlocks = block -> next;
+      return block;
+    }
+
+    if (_slabBgn == _slabEnd)
+      addSlab();
+
+    auto block = _slabBgn;
+    _slabBgn += _blockSize;
+    return block;
+  }
+
+  // Function to give back a block, 'size' has to be the size given to 'allocate'
+  //
+  // time-complexity:
+  //      O(1)
+  void deallocate (void * block, const std::size_t size) {
+    if (size > _blockSize) {
+      ::operator delete (block);
+      return;
+    }
+
+    _freeBlocks = new (block) FreeBlock {_freeBlocks};
+  }
+
+  // Function to give the amount of slabs, which have been allocated
+  inline std::size_t nSlabs (void) const {
+    return _slabs.size();
+  }
+};
+
+// Allocator for the containers of the standard library, which takes single objects from a
+// 'NodePool' (e.g. the nodes of std::forward_list)
+//
+// Arrays are allocated by 'operator new'. Without a pool (default constructor) every object
+// is allocated by 'operator new' as well. Copies of the allocator share the pool.
+// NOTE: The allocator does not own the pool, it has to live as long as the containers using
+//       it (e.g. 'BasicGraphAdjList' keeps the pool of its lists).
+template <typename T>
+class PoolAllocator {
+
+  template <typename U>
+  friend class PoolAllocator;
+
+  NodePool * _pool;
+
+public:
+
+  typedef T value_type;
+
+  // Constructors
+  PoolAllocator ()
+    : _pool (nullptr)
+  {}
+
+  PoolAllocator (NodePool * pool)
+    : _pool (pool)
+  {}
+
+  template <typename U>
+  PoolAllocator (const PoolAllocator <U> & allocator)
+    : _pool (allocator._pool)
+  {}
+
+  T * allocate (const std::size_t n) {
+    if (n == 1 && _pool)
+      return static_cast <T *> (_pool -> allocate (sizeof (T)));
+    return static_cast <T *> (::operator new (n * sizeof (T)));
+  }
+
+  void deallocate (T * object, const std::size_t n) {
+    if (n == 1 && _pool)
+      _pool -> deallocate (object, sizeof (T));
+    else
+      ::operator delete (object);
+  }
+
+  inline NodePool * pool (void) const {
+    return _pool;
+  }
+
+  template <typename U>
+  bool operator== (const PoolAllocator <U> & allocator) const {
+    return _pool == allocator._pool;
+  }
+
+  template <typename U>
+  bool operator!= (const PoolAllocator <U> & allocator) const {
+    return _pool != allocator._pool;
+  }
+};
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef BINARY_EDGE_FILE_H
+#define BINARY_EDGE_FILE_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "topological-sort.h"
+
+// BINARY EDGE FILES
+// A binary edge file starts with a fixed header of 32 bytes, followed by the raw edges.
+// Each edge is stored as source node-id followed by target node-id, every node-id using
+// 'idWidth' bytes. All numbers are stored in the byte order of the machine (little-endian on x86).
+//
+// The file can be read without parsing any text. The flags tell the reader which properties
+// the edges are guaranteed to have. An unset flag does not mean the property is violated.
+
+// magic number at the beginning of each binary edge file
+const char BINARY_EDGE_FILE_MAGIC[4] = {'T', 'S', 'E', 'L'};
+// version of the format written by this code
+const uint32_t BINARY_EDGE_FILE_VERSION = 1;
+
+// properties of the edges stored in a binary edge file
+enum BinaryEdgeFileFlags : uint32_t {
+  // the source node-ids are non-decreasing
+  SORTED_BY_SOURCE = 1u << 0,
+  // no edge occurs twice
+  DEDUPLICATED     = 1u << 1
+};
+
+struct BinaryEdgeFileHeader {
+  char     magic[4];
+  uint32_t version;
+  // amount of bytes for each node-id: 2, 4 or 8
+  uint32_t idWidth;
+  uint32_t flags;
+  uint64_t nNodes;
+  uint64_t nEdges;
+};
+
+static_assert (sizeof (BinaryEdgeFileHeader) == 32, "The header of a binary edge file needs to have 32 bytes.");
+
+// Function to read the node-id at a given position of the edges stored behind the header
+//
+// The source node-id of the i-th edge is at position 2 * i, its target node-id at 2 * i + 1.
+inline uint64_t readBinaryNodeId (const char * payload, const std::size_t position, const uint32_t idWidth) {
+  switch (idWidth) {
+    case 2: { uint16_t nodeId; std::memcpy (&nodeId, payload + position * 2, 2); return nodeId; }
+    case 4: { uint32_t nodeId; std::memcpy (&nodeId, payload + position * 4, 4); return nodeId; }
+    default: { uint64_t nodeId; std::memcpy (&nodeId, payload + position * 8, 8); return nodeId; }
+  }
+}
+
+// Function to write directed edges into a binary edge file
+//
+// The smallest node-id width, which can store all node-ids, is chosen. The flags are
+// determined from the edges.
+//
+// time-complexity:
+//      O(|E|)
+void writeEdgesToBinaryFile (const std::string & filename, const std::vector <Edge> & edges);
+
+// Function to read the header of a binary edge file
+//
+// An exception is thrown, if the file is not a valid binary edge file.
+BinaryEdgeFileHeader readBinaryEdgeFileHeader (const std::string & filename);
+
+// Function to read directed edges from a binary edge file
+//
+// time-complexity:
+//      O(|E|)
+std::vector <Edge> readEdgesFromBinaryFile (const std::string & filename);
+
+std::vector <Edge> readEdgesFromBinaryFile (const std::string & filename, BinaryEdgeFileHeader & header);
+
+// Function to create a directed graph (compressed sparse row) from a binary edge file
+//
+// If the edges are sorted by their source node, the graph is build directly from the
+// file without an intermediate vector of edges.
+//
+// time-complexity:
+//      O(|V| + |E|)
+GraphCSR readGraphCSRFromBinaryFile (const std::string & filename);
+
+// Function to sort the edges of a binary edge file by their source node, using not more than
+// about 'memoryBudget' bytes for the edges
+//
+// External merge sort: runs of edges, which fit into the budget, are sorted in memory and 
+// written into temporary files next to the output file ('outputFilename'.run<i>). Afterwards
+// all runs are merged in one pass into the output file, which gets the flag SORTED_BY_SOURCE.
+// The edges are sorted by source and then by target node-id.
+//
+// time-complexity:
+//      O(|E| * log(|E|))
+void sortBinaryEdgeFileBySource (const std::string & inputFilename, const std::string & outputFilename, const std::size_t memoryBudget);
+
+// Functions to convert edge files between the text and the binary format
+//
+// time-complexity:
+//      O(|E|)
+void convertTextToBinaryEdgeFile (const std::string & textFilename, const std::string & binaryFilename);
+
+void convertBinaryToTextEdgeFile (const std::string & binaryFilename, const std::string & textFilename);
+
+#endif
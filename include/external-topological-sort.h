@@ -0,0 +1,64 @@
+#ifndef EXTERNAL_TOPOLOGICAL_SORT_H
+#define EXTERNAL_TOPOLOGICAL_SORT_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// TOPOLOGICAL SORTING OF GRAPHS LARGER THAN THE MEMORY
+// The graph is read from a binary edge file (see 'binary-edge-file.h') and the sorting is
+// written into a file as raw node-ids of 4 bytes each, in the byte order of the machine.
+// Only the in-degrees, the offsets of the edges of each node within the file and the nodes
+// ready to be sorted are kept in memory, the edges are read in blocks of 'memoryBudget' bytes.
+
+// default amount of bytes the edges may use while sorting them
+const std::size_t EXTERNAL_SORT_MEMORY_BUDGET = std::size_t (1) << 30;
+
+// I/O of a single call of 'topologicalSortExternal'
+struct ExternalSortStatistics {
+  // passes of Kahn's algorithm over the blocks of the sorted edges
+  std::size_t nPasses;
+  // reads of a block of edges (also while computing the in-degrees)
+  std::size_t nBlockReads;
+  // bytes of edges read (without sorting them)
+  uint64_t nBytesRead;
+
+  ExternalSortStatistics ()
+    : nPasses (0)
+    , nBlockReads (0)
+    , nBytesRead (0) {}
+};
+
+// Function which implements topological sorting for a directed acyclic graph (DAG) [Kahn1962 algorithm]
+//
+// If the edges of the file are not flagged as sorted by their source node, they are sorted
+// into a temporary file first ('orderFilename'.sorted, see 'sortBinaryEdgeFileBySource').
+// One sequential pass over the sorted edges gives the in-degrees and the offsets of the edges
+// of each node. Afterwards the nodes are grouped into blocks of consecutive nodes, whose edges
+// fit into 'memoryBudget'. Kahn's algorithm passes over the blocks in the order of the file and
+// reads every block with ready nodes as a whole, nodes becoming ready in another block wait for
+// the next read of their block. The sorted nodes are written in blocks into 'orderFilename'. If
+// the graph contains a cycle, an exception is thrown and no sorting is left behind.
+//
+// memory:
+//      16 * |V| bytes (in-degrees, offsets and ready nodes) + 'memoryBudget'
+// I/O:
+//      Every pass reads each block at most once and in the order of the file, so it reads
+//      at most |E| edges sequentially. A further pass is only needed for a path going back
+//      from a block to an earlier one, so there are at most 1 + the largest number of such
+//      steps on any path ... a single pass, if every edge goes to the same or a later block
+// time-complexity:
+//      O(|V| + |E| + passes * blocks) ... if the edges are sorted by their source node
+//      O(|V| + |E| * log(|E|)) ... else
+void topologicalSortExternal (const std::string & edgeFilename, const std::string & orderFilename, const std::size_t memoryBudget = EXTERNAL_SORT_MEMORY_BUDGET);
+
+// like above, but gives the I/O of the sorting in 'statistics'
+void topologicalSortExternal (const std::string & edgeFilename, const std::string & orderFilename, const std::size_t memoryBudget, ExternalSortStatistics & statistics);
+
+// Function to read a sorting written by 'topologicalSortExternal'
+//
+// time-complexity:
+//      O(|V|)
+std::vector <unsigned int> readTopologicalSortingFromFile (const std::string & orderFilename);
+
+#endif
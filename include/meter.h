@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstdint>
 #include <functional>
 #include <string>
@@ -83,6 +84,66 @@ inline bool hasRDTSC (void) { return true; };
 // Before the time stamp is read, the cpu will be serialized using the 'cpuid' command.
 uint64_t myCycles (void);
 
+// ---------------------------------------------------------------------
+// HARDWARE PERFORMANCE COUNTERS
+// ---------------------------------------------------------------------
+
+// counters read by 'myPerfCounters'
+enum PerfCounter {
+  PERF_CYCLES,
+  PERF_INSTRUCTIONS,
+  PERF_LLC_MISSES,
+  PERF_BRANCH_MISSES,
+  PERF_DTLB_MISSES,
+  N_PERF_COUNTERS
+};
+
+// Values of the hardware performance counters at a point in time, or the difference of two
+// of them. It can be used as 'Measure' and as 'Unit' of a 'Meter'.
+//
+// A counter, which could not be opened (no permission, not supported by the CPU or running
+// within a virtual machine), is marked unavailable and stays zero.
+struct PerfCounters {
+  uint64_t values[N_PERF_COUNTERS];
+  // bit i is set, if counter i is available
+  uint32_t available;
+
+  PerfCounters ()
+    : values ()
+    , available (0) {}
+
+  PerfCounters operator- (const PerfCounters & rhs) const {
+    PerfCounters difference;
+    for (int i = 0; i < N_PERF_COUNTERS; i++)
+      difference.values[i] = values[i] - rhs.values[i];
+    difference.available = available & rhs.available;
+    return difference;
+  }
+
+  uint64_t operator[] (const PerfCounter counter) const { return values[counter]; }
+
+  bool isAvailable (const PerfCounter counter) const { return available & (1u << counter); }
+};
+
+// This function reads the hardware performance counters using the Linux 'perf_event_open'
+// interface
+//
+// The counters are opened on the first call and count the user space events of the calling
+// thread and of the threads it creates afterwards (the events of a thread are added, when it
+// has been joined). If the CPU has less counters than requested, the kernel multiplexes them
+// and the values are scaled by the time each counter has been running.
+PerfCounters myPerfCounters (void);
+
+// This function checks, whether at least one hardware performance counter is available
+bool hasPerfCounters (void);
+
+// This function gives the name of a counter, e.g. to build the header of a measurement file
+const char * getPerfCounterName (const PerfCounter counter);
+
+// This function selects a single counter of measurements of 'PerfCounters', so they can be
+// written out by 'writeMeasurements'
+Matrix <uint64_t> selectPerfCounter (const Matrix <PerfCounters> & measurements, const PerfCounter counter);
+
 // This function can write out measurements
 //
 // NOTE: parameterIdentifier identifies a certain set of parameters
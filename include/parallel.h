@@ -0,0 +1,47 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Function to determine the amount of threads to use
+//
+// 0 means to use one thread per hardware thread. Not more than one thread per 'minWorkPerThread'
+// work items is used, because for small inputs starting the threads costs more than they save.
+inline unsigned int getNumberOfThreads (unsigned int nThreads, const std::size_t nWorkItems = 0, const std::size_t minWorkPerThread = 1) {
+  if (nThreads == 0)
+    nThreads = std::max (1u, std::thread::hardware_concurrency());
+
+  if (nWorkItems > 0)
+    nThreads = std::min <std::size_t> (nThreads, std::max <std::size_t> (1, nWorkItems / minWorkPerThread));
+
+  return nThreads;
+}
+
+// Function to run 'f (threadId)' on 'nThreads' threads and to wait until all of them are done
+//
+// The calling thread is used as thread 0.
+// NOTE: 'f' must not throw, an exception within a thread terminates the program.
+template <typename Function>
+void runInParallel (const unsigned int nThreads, Function f) {
+  std::vector <std::thread> threads;
+  threads.reserve (nThreads);
+
+  for (unsigned int threadId = 1; threadId < nThreads; threadId++)
+    threads.push_back (std::thread (f, threadId));
+
+  f (0);
+
+  for (auto & thread : threads)
+    thread.join();
+}
+
+// Function to give the range [bgn, end) of the 'threadId'-th of 'nThreads' equally sized
+// parts of [0, n)
+inline std::pair <std::size_t, std::size_t> getThreadRange (const std::size_t n, const unsigned int threadId, const unsigned int nThreads) {
+  return std::make_pair (n * threadId / nThreads, n * (threadId + 1) / nThreads);
+}
+
+#endif
@@ -0,0 +1,135 @@
+#ifndef RANDOM_DAG_H
+#define RANDOM_DAG_H
+
+#include <cstdint>
+#include <vector>
+
+#include "topological-sort.h"
+
+// Pseudo random number generator [xoshiro256** algorithm]
+//
+// It is much faster than the generators of <random> and, unlike 'rand', it gives the same
+// numbers on every platform for a given seed. The state is initialized from the seed using
+// splitmix64.
+class RandomGenerator {
+
+  uint64_t _state[4];
+
+  static inline uint64_t rotateLeft (const uint64_t x, const int k) {
+    return (x << k) | (x >> (64 - k));
+  }
+
+public:
+
+  // Constructor
+  RandomGenerator (uint64_t seed = 1) {
+    for (auto & state : _state) {
+      uint64_t z = (seed += 0x9e3779b97f4a7c15);
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+      state = z ^ (z >> 31);
+    }
+  }
+
+  // Function to give the next random 64-bit number
+  inline uint64_t operator() (void) {
+    const uint64_t result = rotateLeft (_state[1] * 5, 7) * 9;
+    const uint64_t t = _state[1] << 17;
+
+    _state[2] ^= _state[0];
+    _state[3] ^= _state[1];
+    _state[1] ^= _state[2];
+    _state[0] ^= _state[3];
+    _state[2] ^= t;
+    _state[3] = rotateLeft (_state[3], 45);
+
+    return result;
+  }
+
+  // Function to give a random number in [0, n)
+  //
+  // NOTE: The number is scaled by a multiplication instead of a division, the bias of at most
+  //       n / 2^64 does not matter for generating graphs.
+  inline uint64_t nextBounded (const uint64_t n) {
+    return uint64_t ((unsigned __int128) (*this)() * n >> 64);
+  }
+
+  // Function to give a random number in [0, 1)
+  inline double nextDouble (void) {
+    return ((*this)() >> 11) * (1.0 / 9007199254740992.0);
+  }
+};
+
+// RANDOM DIRECTED ACYCLIC GRAPHS
+// All functions generate the graph in memory without any external tool. The same seed always
+// gives the same graph. Unless stated otherwise the edges are not sorted and the node-ids are
+// not permuted, so the graphs can be shuffled using 'permuteNodeIds'.
+
+// Function to create a random DAG, where every edge (i, j) with i > j exists with probability
+// 'epsilon' (the lower triangle of the adjacency matrix, like 'scripts/createRandomDAG.R')
+//
+// The pairs are not drawn one by one, the distance to the next edge is drawn from a geometric
+// distribution instead. The edges are sorted by their source and target node.
+//
+// time-complexity:
+//      O(|V| + |E|)
+std::vector <Edge> createRandomDAGEdges (const unsigned int nNodes, const double epsilon, const uint64_t seed = 1);
+
+// Function to create the same DAG as 'createRandomDAGEdges' in the compressed sparse row format
+//
+// The edges are generated ordered by their source node, so the graph is written directly
+// without a vector of edges.
+//
+// time-complexity:
+//      O(|V| + |E|)
+GraphCSR createRandomDAGCSR (const unsigned int nNodes, const double epsilon, const uint64_t seed = 1);
+
+// Function to create a random DAG by recursively partitioning the nodes (like
+// 'scripts/createRandomDAG-moreRandom.R')
+//
+// The nodes are split into two halves, all edges from the first half to the second half exist
+// with probability 'epsilon' and both halves are partitioned again, until they have not more
+// than 2 * 'minGroupSize' nodes. Within these groups the edges (i, j) with i > j exist with
+// probability 'epsilon'.
+//
+// time-complexity:
+//      O(|V| + |E|)
+std::vector <Edge> createMoreRandomDAGEdges (const unsigned int nNodes, const double epsilon, const uint64_t seed = 1, const unsigned int minGroupSize = 8);
+
+// Function to create a chain (i, i + 1) of 'nNodes' nodes
+//
+// time-complexity:
+//      O(|V|)
+std::vector <Edge> createChainDAGEdges (const unsigned int nNodes);
+
+// Function to create a random tree, every node i > 0 gets an edge from a node drawn uniformly
+// from [0, i)
+//
+// time-complexity:
+//      O(|V|)
+std::vector <Edge> createTreeDAGEdges (const unsigned int nNodes, const uint64_t seed = 1);
+
+// Function to create a DAG with 'nLayers' layers of 'layerSize' nodes, every node has edges to
+// 'nEdgesPerNode' random nodes of the next layer (an edge may occur more than once)
+//
+// time-complexity:
+//      O(|V| * nEdgesPerNode)
+std::vector <Edge> createLayeredDAGEdges (const unsigned int nLayers, const unsigned int layerSize, const unsigned int nEdgesPerNode, const uint64_t seed = 1);
+
+// Function to create a DAG with a power-law distribution of the out-degrees [preferential attachment]
+//
+// Every node i > 0 gets edges from (at most) 'nEdgesPerNode' distinct nodes of [0, i). A node
+// is drawn with a probability proportional to its amount of edges plus one, so a few nodes
+// get very many successors.
+//
+// time-complexity:
+//      O(|V| * nEdgesPerNode^2)
+std::vector <Edge> createPowerLawDAGEdges (const unsigned int nNodes, const unsigned int nEdgesPerNode, const uint64_t seed = 1);
+
+// Function to rename the nodes of a graph using a random permutation of [0, nNodes)
+//
+// time-complexity:
+//      O(|V| + |E|)
+void permuteNodeIds (std::vector <Edge> & edges, const unsigned int nNodes, const uint64_t seed = 1);
+
+#endif
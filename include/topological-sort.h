@@ -1,14 +1,77 @@
+#ifndef TOPOLOGICAL_SORT_H
+#define TOPOLOGICAL_SORT_H
+
 #include <algorithm>
+#include <cstdint>
 #include <forward_list>
+#include <limits>
 #include <set>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 #include "matrix.h"
+#include "mytypes.h"
+#include "BitMatrix.h"
 #include "GraphAdjList.h"
+#include "GraphCSR.h"
+#include "GraphCompressed.h"
 
 typedef Matrix <bool> Graph; 
 typedef std::pair <unsigned int, unsigned int> Edge;
 
+// Exception thrown, if the graph given to a sorting function contains a cycle
+//
+// It is derived from std::invalid_argument, which has been thrown before, and carries one
+// cycle of the graph as witness: 'cycle()' gives its nodes in the order of the edges, the
+// edge from the last back to the first node closes it. The functions using the adjacency 
+// matrix or recursion ('topologicalSort', 'topologicalSortAdjList', 'topologicalSortAdjList2',
+// 'topologicalSortCormanAdjList' and 'topologicalSortCormanAdjList2') still throw a bare 
+// std::invalid_argument.
+template <typename NodeId>
+class BasicGraphCycleException : public std::invalid_argument {
+  std::vector <NodeId> _cycle;
+  
+public:
+  BasicGraphCycleException (std::vector <NodeId> cycle);
+  
+  const std::vector <NodeId> & cycle (void) const { return _cycle; }
+};
+
+typedef BasicGraphCycleException <unsigned int> GraphCycleException;
+
+// element of the explicit stack of a depth-first search: a visited node and the range of 
+// edges still to follow
+template <typename NodeId, typename AdjacencyIterator>
+struct SearchFrame {
+  NodeId nodeId;
+  AdjacencyIterator nextEdge, endEdge;
+};
+
+// Buffers of the sorting functions on graphs of type 'DAG', which can be kept to sort several
+// graphs without allocating them again (see 'BatchSorter')
+//
+// Every call overwrites the content, only the capacity is reused.
+template <typename DAG>
+struct SortScratch {
+  typedef typename DAG::NodeIdType NodeId;
+  typedef SearchFrame <NodeId, decltype (std::declval <const DAG &> ()[0].begin())> Frame;
+  
+  // NOTE: Parallel edges can give a node more incoming edges than 'NodeId' holds.
+  std::vector <std::size_t> inDegree;
+  std::vector <NodeColor> nodeColors;
+  std::vector <Frame> stack;
+};
+
+// NODE-ID TYPES
+// The functions on 'BasicGraphAdjList', 'BasicGraphCSR' and 'BasicEdge' are templates on the 
+// type of the node-ids. They are instantiated for uint16_t, uint32_t (= unsigned int, used by 
+// 'GraphAdjList', 'GraphCSR' and 'Edge') and uint64_t. 16-bit ids halve the memory of small 
+// graphs, 64-bit ids allow more than 2^32 nodes. The sortings and cycles use the node-id type
+// of the graph, the in-degrees are counted in std::size_t, because parallel edges can give a
+// node more incoming edges than there are node-ids. The functions on the adjacency matrices and the ones modifying 
+// their graph are only available for 'unsigned int'.
+
 // IMPLEMENTATIONS OF THE TOPOLOGICAL SORTING
 // Function which implements topological sorting for a directed acyclic graph (DAG) [Kahn1962 algorithm]
 //
@@ -18,6 +81,17 @@ typedef std::pair <unsigned int, unsigned int> Edge;
 //      O(|V|^2)
 std::vector <unsigned int> topologicalSort (Graph graph);
 
+// Function which implements topological sorting for a directed acyclic graph (DAG) [Kahn1962 algorithm]
+//
+// The graph has to be given as a bit-packed adjacency matrix. The in-degrees are counted 
+// once using popcount on the words of the transposed matrix and afterwards only decreased, 
+// so no column needs to be scanned again. The successors of a node are found by iterating 
+// the set bits of its row.
+//
+// time-complexity: 
+//      O(|V|^2 / 64 + |E|)
+std::vector <unsigned int> topologicalSortBitMatrix (const BitMatrix & dag);
+
 // Function which implements topological sorting for a directed acyclic graph (DAG) [Kahn1962 algorithm]
 //
 // The graph has to be given as an adjacency list.
@@ -46,6 +120,21 @@ std::vector <unsigned int> topologicalSortAdjList2 (GraphAdjList posDag, GraphAd
 //      O(|V| + |E|)
 std::vector <unsigned int> topologicalSortAdjList3 (GraphAdjList dag);
 
+// Function which implements topological sorting for a directed acyclic graph (DAG) [Kahn1962 algorithm]
+//
+// The graph has to be given as an adjacency list. Unlike 'topologicalSortAdjList3' no copy 
+// of the graph is made, the adjacency lists are only read and only the in-degrees are 
+// decreased. A cycle is detected by counting the sorted nodes.
+//
+// time-complexity: 
+//      O(|V| + |E|)
+template <typename NodeId>
+std::vector <NodeId> topologicalSortAdjList4 (const BasicGraphAdjList <NodeId> & dag);
+
+// like above, but the in-degrees are kept in 'scratch'
+template <typename NodeId>
+std::vector <NodeId> topologicalSortAdjList4 (const BasicGraphAdjList <NodeId> & dag, SortScratch <BasicGraphAdjList <NodeId>> & scratch);
+
 // Function which implements topological sorting for a directed acyclic graph (DAG) [Corman algorithm]
 //
 // The graph has to be given as an adjacency list.
@@ -56,6 +145,174 @@ std::vector <unsigned int> topologicalSortCormanAdjList (GraphAdjList posDag);
 
 std::vector <unsigned int> topologicalSortCormanAdjList2 (const GraphAdjList & posDag);
 
+// Function which implements topological sorting for a directed acyclic graph (DAG) [Corman algorithm]
+//
+// The graph has to be given as an adjacency list. The depth-first search uses an explicit 
+// stack instead of recursion, so long paths do not overflow the call-stack. The roots are 
+// found by running ones over the node colors instead of keeping a set of unmarked nodes.
+// The roots and the sorting are the ones of 'topologicalSortCormanAdjList2', but a graph 
+// without edges gives all its nodes instead of an empty sorting.
+//
+// time-complexity: 
+//      O(|V| + |E|)
+template <typename NodeId>
+std::vector <NodeId> topologicalSortCormanAdjList3 (const BasicGraphAdjList <NodeId> & posDag);
+
+// like above, but the node colors and the stack are kept in 'scratch'
+template <typename NodeId>
+std::vector <NodeId> topologicalSortCormanAdjList3 (const BasicGraphAdjList <NodeId> & posDag, SortScratch <BasicGraphAdjList <NodeId>> & scratch);
+
+// Function which implements topological sorting for a directed acyclic graph (DAG) [Kahn1962 algorithm]
+//
+// The graph has to be given in the compressed sparse row format. The graph is not modified,
+// only the in-degrees are decreased. The output vector is used as queue for the zero-degree 
+// nodes, so no further container is needed.
+//
+// time-complexity: 
+//      O(|V| + |E|)
+template <typename NodeId>
+std::vector <NodeId> topologicalSortCSR (const BasicGraphCSR <NodeId> & dag);
+
+// like above, but the in-degrees are kept in 'scratch'
+template <typename NodeId>
+std::vector <NodeId> topologicalSortCSR (const BasicGraphCSR <NodeId> & dag, SortScratch <BasicGraphCSR <NodeId>> & scratch);
+
+// Function which implements topological sorting for a directed acyclic graph (DAG) [Corman algorithm]
+//
+// The graph has to be given in the compressed sparse row format. The depth-first search uses
+// an explicit stack, so long paths do not overflow the call-stack.
+//
+// time-complexity: 
+//      O(|V| + |E|)
+template <typename NodeId>
+std::vector <NodeId> topologicalSortCormanCSR (const BasicGraphCSR <NodeId> & dag);
+
+// like above, but the node colors and the stack are kept in 'scratch'
+template <typename NodeId>
+std::vector <NodeId> topologicalSortCormanCSR (const BasicGraphCSR <NodeId> & dag, SortScratch <BasicGraphCSR <NodeId>> & scratch);
+
+// Function which implements topological sorting for a directed acyclic graph (DAG) [Kahn1962 algorithm]
+//
+// The graph has to be given with compressed adjacency lists. Like 'topologicalSortCSR' the
+// graph is not modified and the output vector is used as queue, the targets are decoded while
+// the edges are relaxed. The sorting is the one of 'topologicalSortCSR' on a graph with
+// sorted adjacency lists.
+//
+// time-complexity:
+//      O(|V| + |E|)
+template <typename NodeId>
+std::vector <NodeId> topologicalSortCompressed (const BasicGraphCompressed <NodeId> & dag);
+
+// Function which implements topological sorting for a directed acyclic graph (DAG) [Corman algorithm]
+//
+// The graph has to be given with compressed adjacency lists. The frames of the explicit stack
+// keep the decoding position of their node.
+//
+// time-complexity:
+//      O(|V| + |E|)
+template <typename NodeId>
+std::vector <NodeId> topologicalSortCormanCompressed (const BasicGraphCompressed <NodeId> & dag);
+
+// Function which implements topological sorting for a directed acyclic graph (DAG) [Kahn1962 algorithm]
+//
+// The zero-degree node with the smallest id is always taken first, so the sorting is the
+// lexicographically smallest one and the same as the one of 'topologicalSort',
+// 'topologicalSortAdjList' and 'topologicalSortAdjList2'. Instead of a std::set the
+// zero-degree nodes are kept in a hierarchical bitset with 64 children per word, which needs
+// no allocation per node and finds the smallest node by one count-trailing-zeros per level.
+// The graph is not modified.
+//
+// time-complexity:
+//      O(|V| * log_64(|V|) + |E|)
+template <typename NodeId>
+std::vector <NodeId> topologicalSortLexMin (const BasicGraphAdjList <NodeId> & dag);
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortLexMin (const BasicGraphCSR <NodeId> & dag);
+
+// Function which implements topological sorting for a directed acyclic graph (DAG) [Kahn1962 algorithm]
+//
+// The zero-degree node with the highest priority is always taken first, nodes of the same
+// priority are taken by increasing id. 'priorities' has one element per node, e.g. the
+// estimated cost of a job or the length of the longest path starting at the node, so the
+// critical jobs are released first. The zero-degree nodes are kept in a 4-ary heap in a
+// single array, which holds the priority besides the node-id and is allocated once for all
+// nodes. The graph is not modified.
+//
+// NOTE: An exception is thrown, if there is not one priority per node. NaN priorities are
+//       not allowed.
+//
+// time-complexity:
+//      O(|V| * log(|V|) + |E|)
+template <typename NodeId>
+std::vector <NodeId> topologicalSortPriority (const BasicGraphAdjList <NodeId> & dag, const std::vector <double> & priorities);
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortPriority (const BasicGraphCSR <NodeId> & dag, const std::vector <double> & priorities);
+
+// Type to keep a topological sorting grouped into levels
+//
+// The nodes of level i are nodes[levelOffsets[i], levelOffsets[i + 1]). A node is in level i, 
+// if the longest path from any node without incoming edges to it has i edges. So all nodes 
+// of a level only depend on nodes of earlier levels and can be processed in parallel.
+template <typename NodeId>
+struct BasicTopologicalLevels {
+  std::vector <NodeId> levelOffsets;
+  std::vector <NodeId> nodes;
+  
+  std::size_t nLevels (void) const { return levelOffsets.size() - 1; }
+};
+
+typedef BasicTopologicalLevels <unsigned int> TopologicalLevels;
+
+// Function which implements topological sorting for a directed acyclic graph (DAG) [Kahn1962 algorithm]
+//
+// The sorting is returned grouped into levels (see 'TopologicalLevels'). The zero-degree 
+// nodes are processed level by level: a node becomes zero-degree, while its last parent is 
+// processed, so it belongs to the level after the one of this parent. The graph is not modified.
+//
+// time-complexity: 
+//      O(|V| + |E|)
+template <typename NodeId>
+BasicTopologicalLevels <NodeId> topologicalSortLevels (const BasicGraphAdjList <NodeId> & dag);
+
+template <typename NodeId>
+BasicTopologicalLevels <NodeId> topologicalSortLevels (const BasicGraphCSR <NodeId> & dag);
+
+// Function which implements topological sorting for a directed acyclic graph (DAG) [Kahn1962 algorithm]
+//
+// The sorting runs on 'nThreads' threads (0 means one per hardware thread). Every thread 
+// keeps its own queue of zero-degree nodes and steals from the queues of the other threads, 
+// if its own one is empty. The in-degrees are decreased atomically and the position of each 
+// node within the sorting is claimed using an atomic counter. The graph is not modified.
+//
+// NOTE: The sorting is not deterministic.
+//
+// time-complexity: 
+//      O((|V| + |E|) / nThreads) if the DAG is wide enough
+template <typename NodeId>
+std::vector <NodeId> topologicalSortParallel (const BasicGraphAdjList <NodeId> & dag, unsigned int nThreads = 0);
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortParallel (const BasicGraphCSR <NodeId> & dag, unsigned int nThreads = 0);
+
+// Function to find a cycle in a directed graph
+//
+// A depth-first search with an explicit stack is run and aborted at the first back edge, 
+// the nodes on the stack from the target of this edge to its source form the cycle. An empty
+// vector is returned, if the graph is a DAG.
+//
+// time-complexity:
+//      O(|V| + |E|)
+template <typename NodeId>
+std::vector <NodeId> findCycle (const BasicGraphAdjList <NodeId> & graph);
+
+template <typename NodeId>
+std::vector <NodeId> findCycle (const BasicGraphCSR <NodeId> & graph);
+
+template <typename NodeId>
+std::vector <NodeId> findCycle (const BasicGraphCompressed <NodeId> & graph);
+
 // HELPER FUNCTION FOR THE SORTING ALGORITHMS
 // Function to check, whether a given vertex has an incoming edge
 //
@@ -71,9 +328,23 @@ bool hasDAGEdges (const Graph & dag);
 
 // Function to calculate the amount of incoming edges for each node in a given DAG
 //
+// NOTE: The graphs keep parallel edges, so a node can have more incoming edges than the 
+//       largest node-id. The in-degrees are counted in std::size_t for every node-id type.
+//
 // time-complexity:
 //      O(|E|)
-std::vector <unsigned int> getInDegree (const GraphAdjList & dag);
+template <typename NodeId>
+std::vector <std::size_t> getInDegree (const BasicGraphAdjList <NodeId> & dag);
+
+template <typename NodeId>
+std::vector <std::size_t> getInDegree (const BasicGraphCSR <NodeId> & dag);
+
+template <typename NodeId>
+std::vector <std::size_t> getInDegree (const BasicGraphCompressed <NodeId> & dag);
+
+// time-complexity:
+//      O(|V|^2 / 64)
+std::vector <unsigned int> getInDegree (const BitMatrix & dag);
 
 // time-complexity: ?
 void visit (const unsigned int sourceNodeId, GraphAdjList & posDag, std::vector<unsigned int> & L, std::set <unsigned int> & unmarkedNodes);
@@ -89,16 +360,72 @@ bool checkTopologicalSorting (const std::vector <unsigned int> & topologicalSort
 
 // Function to check, whether a given topological sorting is valid
 //
+// The sorting has to be a permutation of the nodes. The position of every node within the 
+// sorting is determined ones and afterwards each edge (u, v) is checked to fulfill 
+// pos(u) < pos(v). The edges are checked on 'nThreads' threads (0 means one per hardware 
+// thread), small graphs are checked by one thread.
+//
 // time-complexity:
-//      O(|V| * |E|)
-bool checkTopologicalSorting (const std::vector <unsigned int> & topologicalSorting, const GraphAdjList & dag);
+//      O(|V| + |E| / nThreads)
+template <typename NodeId>
+bool checkTopologicalSorting (const std::vector <NodeId> & topologicalSorting, const BasicGraphAdjList <NodeId> & dag, unsigned int nThreads = 0);
+
+template <typename NodeId>
+bool checkTopologicalSorting (const std::vector <NodeId> & topologicalSorting, const BasicGraphCSR <NodeId> & dag, unsigned int nThreads = 0);
+
+template <typename NodeId>
+bool checkTopologicalSorting (const std::vector <NodeId> & topologicalSorting, const BasicGraphCompressed <NodeId> & dag, unsigned int nThreads = 0);
 
 // FUNCTIONS TO READ GRAPHS FROM FILES AND CREATE REPRESENTATIONS TO PROCESS THEM
+// Type to report the throughput of reading a file
+struct ReadStatistics {
+  std::size_t nBytes;
+  timeDuration duration;
+  
+  double bytesPerSecond (void) const {
+    return duration.count() > 0 ? nBytes / (duration.count() * 1e-9) : 0.0;
+  }
+};
+
 // Function to read a directed edges from a file
+//
+// The file is mapped into memory and parsed by 'parseEdges'.
 std::vector <Edge> readEdgesFromFile (const std::string & filename);
 
 void readEdgesFromFile (const std::string & filename, std::vector <Edge> & posEdges, std::vector <Edge> & negEdges);
 
+// Function to read a directed edges from a file, which also reports the bytes read per second
+//
+// The file is mapped into memory, the edge vector is presized using the amount of lines and
+// the integers are parsed directly from the mapped pages.
+//
+// time-complexity:
+//      O(|E|)
+std::vector <Edge> readEdgesFromMappedFile (const std::string & filename, ReadStatistics & statistics);
+
+// Function to parse directed edges from a character buffer and append them to 'edges'
+//
+// The node-ids have to be unsigned integers, WHITESPACE and NEWLINE are delimiters. Like 
+// 'std::istream >>' the parsing stops at the first token, which is not a valid node-id, and a 
+// last source node without target node is ignored. It returns the position where parsing stopped.
+//
+// time-complexity:
+//      O(end - bgn)
+const char * parseEdges (const char * bgn, const char * end, std::vector <Edge> & edges);
+
+// Function to read directed edges from a file using several threads
+//
+// The file is mapped into memory and split into 'nThreads' chunks (0 means one per hardware 
+// thread), which end behind a NEWLINE. Every thread parses the node-ids of its chunk into its
+// own buffer. Afterwards the node-ids are paired by their position within the file and copied
+// into the edge vector in parallel. So the edges are the same as the ones of 
+// 'readEdgesFromFile', even if an edge spans a NEWLINE or the file holds an invalid token.
+// Files smaller than 1 MiB per thread use less threads.
+//
+// time-complexity:
+//      O(|E| / nThreads)
+std::vector <Edge> readEdgesFromFileParallel (const std::string & filename, unsigned int nThreads = 0);
+
 // Function to create a directed graph (matrix) from a vector of given edges
 //
 // time-complexity:
@@ -107,9 +434,73 @@ Graph createGraphFromEdges (const std::vector <Edge> & edges);
 
 // Function to create a directed graph (adjacency list) from a vector of given edges
 //
+// An exception is thrown, if the largest node-id is the largest value of 'NodeId', because
+// the amount of nodes would not fit into 'NodeId'.
+//
 // time-complexity:
 //      O(|E|)
-GraphAdjList createGraphAdjListFromEdges (const std::vector <Edge> & edges);
+template <typename NodeId>
+BasicGraphAdjList <NodeId> createGraphAdjListFromEdges (const std::vector <BasicEdge <NodeId>> & edges);
+
+// Function to create a directed graph (bit-packed matrix) from a vector of given edges
+//
+// time-complexity:
+//      O(|V|^2 / 64 + |E|)
+BitMatrix createBitMatrixFromEdges (const std::vector <Edge> & edges);
+
+// Function to create a bit-packed matrix from an adjacency matrix
+//
+// time-complexity:
+//      O(|V|^2)
+BitMatrix createBitMatrixFromGraph (const Graph & graph);
+
+// Function to create a directed graph (compressed sparse row) from a vector of given edges
+//
+// The edges are distributed using a counting sort by their source node. The order of the 
+// edges having the same source node is kept. Like 'createGraphAdjListFromEdges' an exception 
+// is thrown, if the amount of nodes does not fit into 'NodeId'.
+//
+// time-complexity:
+//      O(|V| + |E|)
+template <typename NodeId>
+BasicGraphCSR <NodeId> createGraphCSRFromEdges (const std::vector <BasicEdge <NodeId>> & edges);
+
+// Function to create a directed graph (compressed sparse row) from a vector of given edges 
+// using several threads
+//
+// Like 'createGraphCSRFromEdges' the edges are distributed using a counting sort by their 
+// source node and the graph is the same. The nodes are split into ranges (buckets) of 
+// consecutive nodes: every thread moves the edges of its part of the edge vector into a buffer
+// ordered by the buckets, afterwards every thread sorts whole buckets by their nodes. Only
+// nThreads^2 counters and one bucket of counters per thread are needed besides the buffer of
+// |E| edges, so also sparse graphs use all threads. 'nThreads' = 0 means one thread per
+// hardware thread. Less threads are used for less than 2^16 edges per thread.
+//
+// The second function builds the graph of the reversed edges ('negDag', the ingoing edges of
+// every node in the order of the edge vector) with the same buffer.
+//
+// time-complexity:
+//      O((|V| + |E|) / nThreads + nThreads^2)
+template <typename NodeId>
+BasicGraphCSR <NodeId> createGraphCSRFromEdgesParallel (const std::vector <BasicEdge <NodeId>> & edges, unsigned int nThreads = 0);
+
+template <typename NodeId>
+void createGraphCSRFromEdgesParallel (const std::vector <BasicEdge <NodeId>> & edges, BasicGraphCSR <NodeId> & posDag, BasicGraphCSR <NodeId> & negDag, unsigned int nThreads = 0);
+
+// Function to create a directed graph with compressed adjacency lists from a vector of given 
+// edges or from a graph in the compressed sparse row format
+//
+// The targets of every node are sorted and encoded as differences (see 'BasicGraphCompressed').
+// Like 'createGraphCSRFromEdges' an exception is thrown, if the amount of nodes does not fit 
+// into 'NodeId'.
+//
+// time-complexity:
+//      O(|V| + |E| * log(max out-degree))
+template <typename NodeId>
+BasicGraphCompressed <NodeId> createGraphCompressedFromEdges (const std::vector <BasicEdge <NodeId>> & edges);
+
+template <typename NodeId>
+BasicGraphCompressed <NodeId> createGraphCompressedFromCSR (const BasicGraphCSR <NodeId> & graph);
 
 // time-complexity:
 //      O(|E|)
@@ -119,5 +510,27 @@ GraphAdjList mapFromPosIndecencyToNegIndecency (const GraphAdjList & posIndecenc
 //
 // time-complexity:
 //      O(|E|)
-unsigned int getMaxNodeId (const std::vector <Edge> edges);
+template <typename NodeId>
+NodeId getMaxNodeId (const std::vector <BasicEdge <NodeId>> & edges);
+
+// Function to convert edges to another type of node-ids
+//
+// An exception is thrown, if a node-id does not fit into 'NodeId'.
+//
+// time-complexity:
+//      O(|E|)
+template <typename NodeId, typename SourceNodeId>
+std::vector <BasicEdge <NodeId>> convertEdges (const std::vector <BasicEdge <SourceNodeId>> & edges) {
+  std::vector <BasicEdge <NodeId>> convertedEdges;
+  convertedEdges.reserve (edges.size());
+  
+  for (auto & edge : edges) {
+    if (uint64_t (edge.first) > uint64_t (std::numeric_limits <NodeId>::max()) || uint64_t (edge.second) > uint64_t (std::numeric_limits <NodeId>::max()))
+      throw std::invalid_argument ("Node-id does not fit into the node-id type.");
+    convertedEdges.push_back (BasicEdge <NodeId> (edge.first, edge.second));
+  }
+  
+  return convertedEdges;
+}
 
+#endif
@@ -0,0 +1,88 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <cstdint>
+#include <string>
+
+// HOT-PATH INSTRUMENTATION
+// The sorting, loading and building functions record the time of their phases and some
+// counters (e.g. the amount of relaxed edges) into a process wide trace, which can be written
+// as Chrome trace (chrome://tracing, Perfetto) or as flat CSV file.
+//
+// The instrumentation is only compiled into the functions with -DTOPSORT_TRACE (make TRACE=1),
+// otherwise all TRACE_* macros expand to nothing and the code is the same as without them.
+// Unlike the 'profiling' target no -fno-inline is needed, the functions are measured as they
+// are optimized.
+//
+// NOTE: The names have to be string literals (or live as long as the trace), they are not
+//       copied.
+
+// Scope, which records the time from its construction till 'stop' or its destruction as event
+// of the trace
+class TraceScope {
+
+  const char * _name;
+  uint64_t _startNs;
+
+public:
+
+  // Constructor
+  TraceScope (const char * name);
+
+  // Destructor
+  ~TraceScope ();
+
+  // Function to record the event, before the scope ends
+  void stop (void);
+};
+
+// Function to record the value of a counter
+void recordTraceCounter (const char * name, const uint64_t value);
+
+// Function to delete all recorded events
+void clearTrace (void);
+
+// Function to give the amount of recorded events
+std::size_t getTraceSize (void);
+
+// Function to write the events as Chrome trace [JSON trace event format]
+//
+// Scopes become complete events ("ph": "X") and counters become counter events ("ph": "C"),
+// the times are given in microseconds since the first use of the trace.
+void writeTraceChromeJSON (const std::string & filename);
+
+// Function to write the events as CSV file with the columns
+// type,name,thread,start_ns,duration_ns,value
+void writeTraceCSV (const std::string & filename);
+
+#define TRACE_CONCAT_IMPL(a, b) a ## b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL (a, b)
+
+#ifdef TOPSORT_TRACE
+
+// time of the current scope
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT (traceScope, __LINE__) (name)
+// time of a phase, which is ended explicitly by TRACE_PHASE_END
+#define TRACE_PHASE_BEGIN(phase, name) TraceScope TRACE_CONCAT (tracePhase_, phase) (name)
+#define TRACE_PHASE_END(phase) TRACE_CONCAT (tracePhase_, phase).stop()
+
+// counters, which are kept in a local variable, so the hot loops do not touch the trace
+#define TRACE_LOCAL_COUNTER(counter) uint64_t counter = 0
+#define TRACE_INCREMENT(counter) (++(counter))
+#define TRACE_UPDATE_MAX(counter, value) ((counter) = (counter) < uint64_t (value) ? uint64_t (value) : (counter))
+#define TRACE_COUNTER(name, value) recordTraceCounter (name, value)
+
+#else
+
+#define TRACE_SCOPE(name) ((void) 0)
+#define TRACE_PHASE_BEGIN(phase, name) ((void) 0)
+#define TRACE_PHASE_END(phase) ((void) 0)
+
+#define TRACE_LOCAL_COUNTER(counter) ((void) 0)
+#define TRACE_INCREMENT(counter) ((void) 0)
+#define TRACE_UPDATE_MAX(counter, value) ((void) 0)
+#define TRACE_COUNTER(name, value) ((void) 0)
+
+#endif
+
+#endif
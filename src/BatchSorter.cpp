@@ -0,0 +1,131 @@
+#include "BatchSorter.h"
+#include "parallel.h"
+#include "topological-sort.h"
+
+#include <algorithm>
+#include <atomic>
+
+struct BatchSortScratch {
+  // one set of buffers per graph type, because the frames keep iterators of the adjacency
+  SortScratch <GraphCSR> csr;
+  SortScratch <GraphAdjList> adjList;
+};
+
+// Functions to sort a single graph of a batch with the single-graph functions, the buffers are
+// kept in 'scratch'
+static std::vector <unsigned int> sortGraph (const GraphCSR & dag, const BatchSortAlgorithm algorithm, BatchSortScratch & scratch) {
+  if (algorithm == BatchSortAlgorithm::KAHN)
+    return topologicalSortCSR (dag, scratch.csr);
+  return topologicalSortCormanCSR (dag, scratch.csr);
+}
+
+static std::vector <unsigned int> sortGraph (const GraphAdjList & dag, const BatchSortAlgorithm algorithm, BatchSortScratch & scratch) {
+  if (algorithm == BatchSortAlgorithm::KAHN)
+    return topologicalSortAdjList4 (dag, scratch.adjList);
+  return topologicalSortCormanAdjList3 (dag, scratch.adjList);
+}
+
+BatchSorter::BatchSorter (const unsigned int nThreads)
+  : _nThreads (getNumberOfThreads (nThreads))
+  , _nBatches (0)
+  , _nBusyThreads (0)
+  , _stop (false)
+{
+  for (unsigned int threadId = 0; threadId < _nThreads; threadId++)
+    _scratch.push_back (std::unique_ptr <BatchSortScratch> (new BatchSortScratch()));
+
+  // the calling thread of 'sort' is thread 0
+  for (unsigned int threadId = 1; threadId < _nThreads; threadId++)
+    _threads.push_back (std::thread (&BatchSorter::work, this, threadId));
+}
+
+BatchSorter::~BatchSorter () {
+  {
+    std::lock_guard <std::mutex> lock (_mutex);
+    _stop = true;
+  }
+  _batchStarted.notify_all();
+
+  for (auto & thread : _threads)
+    thread.join();
+}
+
+void BatchSorter::work (const unsigned int threadId) {
+  unsigned long nBatches = 0;
+
+  while (true) {
+    std::function <void (unsigned int)> task;
+    {
+      std::unique_lock <std::mutex> lock (_mutex);
+      _batchStarted.wait (lock, [&]() { return _stop || _nBatches != nBatches; });
+      if (_stop)
+        return;
+
+      nBatches = _nBatches;
+      task = _task;
+    }
+
+    task (threadId);
+
+    std::lock_guard <std::mutex> lock (_mutex);
+    if (--_nBusyThreads == 0)
+      _batchDone.notify_all();
+  }
+}
+
+void BatchSorter::run (std::function <void (unsigned int)> task) {
+  {
+    std::lock_guard <std::mutex> lock (_mutex);
+    _task = task;
+    _nBusyThreads = _nThreads - 1;
+    _nBatches++;
+  }
+  _batchStarted.notify_all();
+
+  task (0);
+
+  std::unique_lock <std::mutex> lock (_mutex);
+  _batchDone.wait (lock, [&]() { return _nBusyThreads == 0; });
+}
+
+template <typename DAG>
+std::vector <BatchSortResult> BatchSorter::sortBatch (const std::vector <DAG> & dags, const BatchSortAlgorithm algorithm) {
+  std::lock_guard <std::mutex> batchLock (_batchMutex);
+
+  std::vector <BatchSortResult> results (dags.size());
+
+  // NOTE: The graphs are handed out in chunks, so the threads do not fight for the counter,
+  //       but at least eight chunks per thread balance graphs of different sizes.
+  const std::size_t chunkSize = std::max <std::size_t> (1, std::min <std::size_t> (64, dags.size() / (8 * _nThreads)));
+  std::atomic <std::size_t> nextGraph (0);
+
+  auto task = [&](unsigned int threadId) {
+    auto & scratch = *_scratch[threadId];
+
+    for (auto bgn = nextGraph.fetch_add (chunkSize); bgn < dags.size(); bgn = nextGraph.fetch_add (chunkSize)) {
+      for (auto i = bgn; i < std::min (dags.size(), bgn + chunkSize); i++) {
+        try {
+          results[i].sorting = sortGraph (dags[i], algorithm, scratch);
+        } catch (...) {
+          results[i].error = std::current_exception();
+        }
+      }
+    }
+  };
+
+  // a single chunk is sorted without waking up the other threads
+  if (dags.size() <= chunkSize || _nThreads == 1)
+    task (0);
+  else
+    run (task);
+
+  return results;
+}
+
+std::vector <BatchSortResult> BatchSorter::sort (const std::vector <GraphCSR> & dags, const BatchSortAlgorithm algorithm) {
+  return sortBatch (dags, algorithm);
+}
+
+std::vector <BatchSortResult> BatchSorter::sort (const std::vector <GraphAdjList> & dags, const BatchSortAlgorithm algorithm) {
+  return sortBatch (dags, algorithm);
+}
@@ -0,0 +1,49 @@
+#include "DenseIdMap.h"
+#include "MappedFile.h"
+
+// Function to parse a 64-bit key, returns false if the token is not a valid key
+static inline bool parseKey (const char * bgn, const char * end, uint64_t & key) {
+  return parseNumber (bgn, end, key) && bgn == end;
+}
+
+// Function to read the edges of a mapped file, 'insertKey (bgn, end, nodeId)' maps a token to
+// its node-id and returns false, if the token is not a valid key
+template <typename InsertKey>
+static std::vector <Edge> readEdgesWithKeys (const std::string & filename, InsertKey insertKey) {
+  MappedFile file (filename);
+
+  std::vector <Edge> edges;
+  edges.reserve (countLines (file.begin(), file.end()));
+
+  const char * it = file.begin();
+  const char * sourceBgn, * sourceEnd, * targetBgn, * targetEnd;
+  unsigned int sourceNodeId, targetNodeId;
+  while (nextToken (it, file.end(), sourceBgn, sourceEnd) && nextToken (it, file.end(), targetBgn, targetEnd)) {
+    if (! insertKey (sourceBgn, sourceEnd, sourceNodeId) || ! insertKey (targetBgn, targetEnd, targetNodeId))
+      break;
+    edges.push_back (Edge (sourceNodeId, targetNodeId));
+  }
+
+  return edges;
+}
+
+std::vector <Edge> readEdgesWithSparseIdsFromFile (const std::string & filename, DenseIdMap <uint64_t> & ids) {
+  return readEdgesWithKeys (filename, [&](const char * bgn, const char * end, unsigned int & nodeId) {
+    uint64_t key;
+    if (! parseKey (bgn, end, key))
+      return false;
+
+    nodeId = ids.insert (key);
+    return true;
+  });
+}
+
+std::vector <Edge> readEdgesWithKeysFromFile (const std::string & filename, DenseIdMap <std::string> & ids) {
+  // NOTE: The string is kept, so its buffer is reused for every key.
+  std::string key;
+  return readEdgesWithKeys (filename, [&](const char * bgn, const char * end, unsigned int & nodeId) {
+    key.assign (bgn, end);
+    nodeId = ids.insert (key);
+    return true;
+  });
+}
@@ -0,0 +1,109 @@
+#include "DynamicTopologicalOrder.h"
+#include "topological-sort.h"
+
+#include <algorithm>
+
+DynamicTopologicalOrder::DynamicTopologicalOrder (const GraphAdjList & dag)
+  : _posDag (dag)
+  , _negDag (dag.nNodes())
+  , _order (topologicalSortAdjList4 (dag))
+  , _position (dag.nNodes())
+  , _visited (dag.nNodes(), false)
+{
+  for (unsigned int sourceNodeId = 0; sourceNodeId < dag.nNodes(); sourceNodeId++)
+    for (auto targetNodeId : dag[sourceNodeId])
+      _negDag.insertEdge (Edge (targetNodeId, sourceNodeId), false);
+
+  for (unsigned int i = 0; i < _order.size(); i++)
+    _position[_order[i]] = i;
+}
+
+bool DynamicTopologicalOrder::collectNodes (const GraphAdjList & dag, const unsigned int sourceNodeId
+                                          , const unsigned int lowerBound, const unsigned int upperBound
+                                          , const unsigned int stopPosition, std::vector <unsigned int> & nodes) {
+  _stack.clear();
+  _stack.push_back (sourceNodeId);
+  _visited[sourceNodeId] = true;
+  nodes.push_back (sourceNodeId);
+
+  while (! _stack.empty()) {
+    auto n = _stack.back();
+    _stack.pop_back();
+
+    for (auto m : dag[n]) {
+      if (_position[m] == stopPosition)
+        return false;
+
+      if (_visited[m] || _position[m] <= lowerBound || _position[m] >= upperBound)
+        continue;
+
+      _visited[m] = true;
+      nodes.push_back (m);
+      _stack.push_back (m);
+    }
+  }
+
+  return true;
+}
+
+bool DynamicTopologicalOrder::insertEdge (const Edge & e) {
+  // a self-loop is a cycle as well
+  if (e.first == e.second) {
+    if (e.first >= nNodes())
+      throw std::invalid_argument ("Array index out of bounds.");
+    return false;
+  }
+
+  const auto lowerBound = position (e.second);
+  const auto upperBound = position (e.first);
+
+  // the sorting is still valid
+  if (lowerBound > upperBound) {
+    _posDag.insertEdge (e, false);
+    _negDag.insertEdge (Edge (e.second, e.first), false);
+    return true;
+  }
+
+  // collect the nodes reachable from e.second, which are sorted before e.first ...
+  _forwardNodes.clear();
+  if (! collectNodes (_posDag, e.second, lowerBound, upperBound, upperBound, _forwardNodes)) {
+    // ... if e.first is one of them, the edge would close a cycle
+    for (auto nodeId : _forwardNodes)
+      _visited[nodeId] = false;
+    return false;
+  }
+
+  // ... and the nodes reaching e.first, which are sorted behind e.second
+  _backwardNodes.clear();
+  collectNodes (_negDag, e.first, lowerBound, upperBound, nNodes(), _backwardNodes);
+
+  // the backward nodes have to be sorted before the forward nodes, both keep their relative
+  // order and together they get the positions they had before
+  auto byPosition = [this](unsigned int a, unsigned int b) { return _position[a] < _position[b]; };
+  std::sort (_forwardNodes.begin(), _forwardNodes.end(), byPosition);
+  std::sort (_backwardNodes.begin(), _backwardNodes.end(), byPosition);
+
+  _positions.clear();
+  for (auto nodeId : _backwardNodes)
+    _positions.push_back (_position[nodeId]);
+  for (auto nodeId : _forwardNodes)
+    _positions.push_back (_position[nodeId]);
+  std::inplace_merge (_positions.begin(), _positions.begin() + _backwardNodes.size(), _positions.end());
+
+  unsigned int i = 0;
+  for (auto nodeIds : {&_backwardNodes, &_forwardNodes})
+    for (auto nodeId : *nodeIds) {
+      _position[nodeId] = _positions[i];
+      _order[_positions[i++]] = nodeId;
+      _visited[nodeId] = false;
+    }
+
+  _posDag.insertEdge (e, false);
+  _negDag.insertEdge (Edge (e.second, e.first), false);
+  return true;
+}
+
+void DynamicTopologicalOrder::deleteEdge (const Edge & e) {
+  _posDag.deleteEdge (e);
+  _negDag.deleteEdge (Edge (e.second, e.first));
+}
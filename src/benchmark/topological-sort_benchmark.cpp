@@ -0,0 +1,528 @@
+// Benchmark of the sorting functions, the loaders and the validators
+//
+// Every registered function is run on a sweep over graph families, sizes and densities. For
+// every combination the time of 'runs' repetitions (after one warm-up run) is measured and
+// min, median and 99th percentile are reported together with the throughput and the median of
+// the hardware performance counters (if available), either as CSV or as JSON. The output file
+// is overwritten.
+//
+// usage: topological-sort_benchmark [--format csv|json] [--output FILE] [--runs N]
+//                                   [--filter SUBSTRING] [--max-edges N] [--quick]
+//                                   [--trace FILE]
+//
+// With --trace the phases of the functions are written as Chrome trace (FILE ending with
+// '.json') or as CSV file. This needs the instrumentation, which is only compiled with
+// 'make bench TRACE=1'.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "meter.h"
+#include "BatchSorter.h"
+#include "binary-edge-file.h"
+#include "external-topological-sort.h"
+#include "random-dag.h"
+#include "topological-sort.h"
+#include "trace.h"
+
+typedef std::chrono::steady_clock::time_point steadyTimePoint;
+
+// options of the benchmark given on the command line
+struct BenchmarkOptions {
+  std::string format = "csv";
+  std::string output = "measurements/benchmark.csv";
+  unsigned int nRuns = 10;
+  std::string filter;
+  std::size_t maxEdges = std::size_t (1) << 24;
+  bool quick = false;
+  std::string trace;
+};
+
+// graph to run the benchmarks on, every representation is only created if it is needed
+struct Workload {
+  std::string family;
+  double density;
+  std::vector <Edge> edges;
+  unsigned int nNodes;
+
+  std::string textFilename;
+  std::string binaryFilename;
+
+  std::unique_ptr <GraphAdjList> adjList;
+  std::unique_ptr <GraphAdjList> negAdjList;
+  std::unique_ptr <GraphCSR> csr;
+  std::unique_ptr <GraphCompressed> compressed;
+  std::unique_ptr <BitMatrix> bitMatrix;
+  std::unique_ptr <Graph> matrix;
+  std::vector <unsigned int> sorting;
+  std::vector <double> priorities;
+  std::vector <GraphCSR> batch;
+
+  const GraphAdjList & getAdjList (void) {
+    if (! adjList)
+      adjList.reset (new GraphAdjList (createGraphAdjListFromEdges (edges)));
+    return *adjList;
+  }
+
+  const GraphAdjList & getNegAdjList (void) {
+    if (! negAdjList)
+      negAdjList.reset (new GraphAdjList (mapFromPosIndecencyToNegIndecency (getAdjList())));
+    return *negAdjList;
+  }
+
+  const GraphCSR & getCSR (void) {
+    if (! csr)
+      csr.reset (new GraphCSR (createGraphCSRFromEdges (edges)));
+    return *csr;
+  }
+
+  const GraphCompressed & getCompressed (void) {
+    if (! compressed)
+      compressed.reset (new GraphCompressed (createGraphCompressedFromCSR (getCSR())));
+    return *compressed;
+  }
+
+  const BitMatrix & getBitMatrix (void) {
+    if (! bitMatrix)
+      bitMatrix.reset (new BitMatrix (createBitMatrixFromEdges (edges)));
+    return *bitMatrix;
+  }
+
+  const Graph & getMatrix (void) {
+    if (! matrix)
+      matrix.reset (new Graph (createGraphFromEdges (edges)));
+    return *matrix;
+  }
+
+  const std::vector <unsigned int> & getSorting (void) {
+    if (sorting.empty())
+      sorting = topologicalSortCSR (getCSR());
+    return sorting;
+  }
+
+  // deterministic priorities with many ties, for 'topologicalSortPriority'
+  const std::vector <double> & getPriorities (void) {
+    if (priorities.size() != nNodes) {
+      priorities.resize (nNodes);
+      for (unsigned int nodeId = 0; nodeId < nNodes; nodeId++)
+        priorities[nodeId] = (uint64_t (nodeId) * 7919) % 1009;
+    }
+    return priorities;
+  }
+
+  // batch of |V| / 64 random DAGs of 64 nodes, which have about as many edges together as the
+  // graph (at most complete DAGs), so the throughput per edge compares to the other functions
+  const std::vector <GraphCSR> & getBatch (void) {
+    if (batch.empty()) {
+      const unsigned int batchNodes = 64;
+      const unsigned int nGraphs = std::max (1u, nNodes / batchNodes);
+      const double epsilon = std::min (1.0, double (edges.size()) / nGraphs / (batchNodes * (batchNodes - 1) / 2));
+      for (unsigned int i = 0; i < nGraphs; i++)
+        batch.push_back (createRandomDAGCSR (batchNodes, epsilon, i + 1));
+    }
+    return batch;
+  }
+
+  const std::string & getTextFile (void) {
+    if (textFilename.empty()) {
+      textFilename = "benchmark-graph.dat";
+      writeEdgesToBinaryFile (textFilename + ".bin", edges);
+      convertBinaryToTextEdgeFile (textFilename + ".bin", textFilename);
+      std::remove ((textFilename + ".bin").c_str());
+    }
+    return textFilename;
+  }
+
+  const std::string & getBinaryFile (void) {
+    if (binaryFilename.empty()) {
+      binaryFilename = "benchmark-graph.bin";
+      writeEdgesToBinaryFile (binaryFilename, edges);
+    }
+    return binaryFilename;
+  }
+
+  ~Workload () {
+    if (! textFilename.empty())
+      std::remove (textFilename.c_str());
+    if (! binaryFilename.empty())
+      std::remove (binaryFilename.c_str());
+  }
+};
+
+// a registered function: 'prepare' creates the needed representations outside of the
+// measurement, 'run' is measured
+struct Benchmark {
+  std::string name;
+  std::string kind;
+  // the function is skipped for graphs with more nodes (quadratic memory or time)
+  unsigned int maxNodes;
+  std::function <void (Workload &)> prepare;
+  std::function <void (Workload &)> run;
+};
+
+// statistics of the measurements of one benchmark on one workload
+struct BenchmarkResult {
+  std::string name;
+  std::string kind;
+  std::string family;
+  double density;
+  unsigned int nNodes;
+  std::size_t nEdges;
+  unsigned int nRuns;
+  double minNs, medianNs, p99Ns;
+  // median of the hardware performance counters of a run
+  PerfCounters counters;
+};
+
+// the results of the functions are kept here, so the calls can not be optimized away
+static volatile std::size_t sink;
+
+static std::vector <Benchmark> registerBenchmarks (void) {
+  const unsigned int unlimited = ~0u;
+  const unsigned int quadratic = 1 << 12;
+
+  auto none = [](Workload &) {};
+  auto adjList = [](Workload & w) { w.getAdjList(); };
+  auto csr = [](Workload & w) { w.getCSR(); };
+  auto compressed = [](Workload & w) { w.getCompressed(); };
+  auto batch = [](Workload & w) { w.getBatch(); };
+
+  // the threads of the pool are started once for all batches
+  std::shared_ptr <BatchSorter> batchSorter (new BatchSorter());
+
+  std::vector <Benchmark> benchmarks = {
+    // sorting functions
+      {"topologicalSort", "sort", quadratic, [](Workload & w) { w.getMatrix(); }
+      , [](Workload & w) { sink = topologicalSort (w.getMatrix()).size(); }}
+    , {"topologicalSortBitMatrix", "sort", 1 << 15, [](Workload & w) { w.getBitMatrix(); }
+      , [](Workload & w) { sink = topologicalSortBitMatrix (w.getBitMatrix()).size(); }}
+    , {"topologicalSortAdjList", "sort", 1 << 10, [](Workload & w) { w.getNegAdjList(); }
+      , [](Workload & w) { sink = topologicalSortAdjList (w.getAdjList(), w.getNegAdjList()).size(); }}
+    , {"topologicalSortAdjList2", "sort", quadratic, [](Workload & w) { w.getNegAdjList(); }
+      , [](Workload & w) { sink = topologicalSortAdjList2 (w.getAdjList(), w.getNegAdjList()).size(); }}
+    , {"topologicalSortAdjList3", "sort", unlimited, adjList
+      , [](Workload & w) { sink = topologicalSortAdjList3 (w.getAdjList()).size(); }}
+    , {"topologicalSortAdjList4", "sort", unlimited, adjList
+      , [](Workload & w) { sink = topologicalSortAdjList4 (w.getAdjList()).size(); }}
+    , {"topologicalSortCormanAdjList", "sort", quadratic, adjList
+      , [](Workload & w) { sink = topologicalSortCormanAdjList (w.getAdjList()).size(); }}
+    , {"topologicalSortCormanAdjList2", "sort", 1 << 16, adjList
+      , [](Workload & w) { sink = topologicalSortCormanAdjList2 (w.getAdjList()).size(); }}
+    , {"topologicalSortCormanAdjList3", "sort", unlimited, adjList
+      , [](Workload & w) { sink = topologicalSortCormanAdjList3 (w.getAdjList()).size(); }}
+    , {"topologicalSortCSR", "sort", unlimited, csr
+      , [](Workload & w) { sink = topologicalSortCSR (w.getCSR()).size(); }}
+    , {"topologicalSortCormanCSR", "sort", unlimited, csr
+      , [](Workload & w) { sink = topologicalSortCormanCSR (w.getCSR()).size(); }}
+    , {"topologicalSortCompressed", "sort", unlimited, compressed
+      , [](Workload & w) { sink = topologicalSortCompressed (w.getCompressed()).size(); }}
+    , {"topologicalSortCormanCompressed", "sort", unlimited, compressed
+      , [](Workload & w) { sink = topologicalSortCormanCompressed (w.getCompressed()).size(); }}
+    , {"topologicalSortLexMin", "sort", unlimited, csr
+      , [](Workload & w) { sink = topologicalSortLexMin (w.getCSR()).size(); }}
+    , {"topologicalSortPriorityAdjList", "sort", unlimited, [](Workload & w) { w.getAdjList(); w.getPriorities(); }
+      , [](Workload & w) { sink = topologicalSortPriority (w.getAdjList(), w.getPriorities()).size(); }}
+    , {"topologicalSortPriorityCSR", "sort", unlimited, [](Workload & w) { w.getCSR(); w.getPriorities(); }
+      , [](Workload & w) { sink = topologicalSortPriority (w.getCSR(), w.getPriorities()).size(); }}
+    , {"topologicalSortLevels", "sort", unlimited, csr
+      , [](Workload & w) { sink = topologicalSortLevels (w.getCSR()).nodes.size(); }}
+    , {"topologicalSortParallel", "sort", unlimited, csr
+      , [](Workload & w) { sink = topologicalSortParallel (w.getCSR()).size(); }}
+    , {"BatchSorter", "sort", unlimited, batch
+      , [batchSorter](Workload & w) { sink = batchSorter->sort (w.getBatch()).size(); }}
+    , {"topologicalSortCSRBatch", "sort", unlimited, batch
+      , [](Workload & w) {
+          std::size_t nSortedNodes = 0;
+          for (const auto & dag : w.getBatch())
+            nSortedNodes += topologicalSortCSR (dag).size();
+          sink = nSortedNodes;
+        }}
+    , {"topologicalSortExternal", "sort", unlimited, [](Workload & w) { w.getBinaryFile(); }
+      , [](Workload & w) {
+          topologicalSortExternal (w.getBinaryFile(), "benchmark-graph.order");
+          std::remove ("benchmark-graph.order");
+        }}
+    // loaders and builders
+    , {"readEdgesFromFile", "load", unlimited, [](Workload & w) { w.getTextFile(); }
+      , [](Workload & w) { sink = readEdgesFromFile (w.getTextFile()).size(); }}
+    , {"readEdgesFromFileParallel", "load", unlimited, [](Workload & w) { w.getTextFile(); }
+      , [](Workload & w) { sink = readEdgesFromFileParallel (w.getTextFile()).size(); }}
+    , {"readEdgesFromBinaryFile", "load", unlimited, [](Workload & w) { w.getBinaryFile(); }
+      , [](Workload & w) { sink = readEdgesFromBinaryFile (w.getBinaryFile()).size(); }}
+    , {"readGraphCSRFromBinaryFile", "load", unlimited, [](Workload & w) { w.getBinaryFile(); }
+      , [](Workload & w) { sink = readGraphCSRFromBinaryFile (w.getBinaryFile()).nEdges(); }}
+    , {"createGraphAdjListFromEdges", "load", unlimited, none
+      , [](Workload & w) { sink = createGraphAdjListFromEdges (w.edges).nNodes(); }}
+    , {"createGraphCSRFromEdges", "load", unlimited, none
+      , [](Workload & w) { sink = createGraphCSRFromEdges (w.edges).nEdges(); }}
+    , {"createGraphCSRFromEdgesParallel", "load", unlimited, none
+      , [](Workload & w) { sink = createGraphCSRFromEdgesParallel (w.edges).nEdges(); }}
+    , {"createGraphCompressedFromCSR", "load", unlimited, csr
+      , [](Workload & w) { sink = createGraphCompressedFromCSR (w.getCSR()).nEdges(); }}
+    // validators
+    , {"checkTopologicalSortingMatrix", "validate", quadratic, [](Workload & w) { w.getMatrix(); w.getSorting(); }
+      , [](Workload & w) { sink = checkTopologicalSorting (w.getSorting(), w.getMatrix()); }}
+    , {"checkTopologicalSortingAdjList", "validate", unlimited, [](Workload & w) { w.getAdjList(); w.getSorting(); }
+      , [](Workload & w) { sink = checkTopologicalSorting (w.getSorting(), w.getAdjList()); }}
+    , {"checkTopologicalSortingCSR", "validate", unlimited, [](Workload & w) { w.getSorting(); }
+      , [](Workload & w) { sink = checkTopologicalSorting (w.getSorting(), w.getCSR()); }}
+  };
+
+  return benchmarks;
+}
+
+// Function to create the graphs of the sweep, graphs with more than 'maxEdges' expected edges
+// are left out
+static void forEachWorkload (const BenchmarkOptions & options, std::function <void (Workload &)> f) {
+  struct Parameters {
+    std::string family;
+    unsigned int nNodes;
+    double density;
+  };
+
+  std::vector <unsigned int> denseSizes = options.quick ? std::vector <unsigned int> ({512, 2048})
+                                                        : std::vector <unsigned int> ({1024, 4096, 16384});
+  std::vector <unsigned int> sparseSizes = options.quick ? std::vector <unsigned int> ({1 << 10, 1 << 14})
+                                                         : std::vector <unsigned int> ({1 << 12, 1 << 16, 1 << 20});
+  std::vector <double> densities = {0.001, 0.01, 0.1, 0.5};
+
+  std::vector <Parameters> sweep;
+  for (auto family : {"random", "moreRandom"})
+    for (auto nNodes : denseSizes)
+      for (auto density : densities)
+        sweep.push_back ({family, nNodes, density});
+  // the sparse families have four edges per node on average
+  for (auto family : {"chain", "tree", "layered", "powerLaw"})
+    for (auto nNodes : sparseSizes)
+      sweep.push_back ({family, nNodes, 4.0 / nNodes});
+
+  for (auto & parameters : sweep) {
+    const double maxPairs = double (parameters.nNodes) * (parameters.nNodes - 1) / 2;
+    if (parameters.density * maxPairs > options.maxEdges)
+      continue;
+
+    Workload workload;
+    workload.family = parameters.family;
+    workload.density = parameters.density;
+    workload.nNodes = parameters.nNodes;
+
+    const unsigned int nNodes = parameters.nNodes;
+    if (parameters.family == "random")
+      workload.edges = createRandomDAGEdges (nNodes, parameters.density);
+    else if (parameters.family == "moreRandom")
+      workload.edges = createMoreRandomDAGEdges (nNodes, parameters.density);
+    else if (parameters.family == "chain")
+      workload.edges = createChainDAGEdges (nNodes);
+    else if (parameters.family == "tree")
+      workload.edges = createTreeDAGEdges (nNodes);
+    else if (parameters.family == "layered")
+      workload.edges = createLayeredDAGEdges (64, nNodes / 64, 4);
+    else
+      workload.edges = createPowerLawDAGEdges (nNodes, 4);
+
+    // NOTE: The layered and the power-law graphs may contain an edge twice, which the sorting
+    //       functions using a list of ingoing edges do not support.
+    std::sort (workload.edges.begin(), workload.edges.end());
+    workload.edges.erase (std::unique (workload.edges.begin(), workload.edges.end()), workload.edges.end());
+    
+    // NOTE: The generators give the nodes in a (reverse) topological order, which would favor
+    //       some of the functions.
+    permuteNodeIds (workload.edges, nNodes);
+    workload.nNodes = workload.edges.empty() ? 0 : getMaxNodeId (workload.edges) + 1;
+
+    f (workload);
+  }
+}
+
+// Function to give the value at the given quantile of sorted measurements [nearest rank]
+static double getQuantile (const std::vector <double> & sortedMeasurements, const double quantile) {
+  std::size_t rank = std::size_t (std::ceil (quantile * sortedMeasurements.size()));
+  return sortedMeasurements[std::min (sortedMeasurements.size(), std::max <std::size_t> (rank, 1)) - 1];
+}
+
+static BenchmarkResult runBenchmark (const Benchmark & benchmark, Workload & workload, const unsigned int nRuns) {
+  Meter <steadyTimePoint, timeDuration> meter (std::chrono::steady_clock::now);
+  Meter <PerfCounters, PerfCounters> counterMeter (myPerfCounters);
+
+  benchmark.prepare (workload);
+  // warm-up run, which fills the caches and faults in the pages
+  benchmark.run (workload);
+
+  // NOTE: The counters are read outside of the time measurement, so reading them does not
+  //       add to the times.
+  std::vector <double> measurements (nRuns);
+  std::vector <PerfCounters> counterMeasurements (nRuns);
+  for (unsigned int run = 0; run < nRuns; run++) {
+    counterMeter.start();
+    meter.start();
+    benchmark.run (workload);
+    meter.stop();
+    counterMeter.stop();
+    measurements[run] = meter.peak().count();
+    counterMeasurements[run] = counterMeter.peak();
+  }
+  std::sort (measurements.begin(), measurements.end());
+
+  PerfCounters counters = counterMeasurements.front();
+  for (int counter = 0; counter < N_PERF_COUNTERS; counter++) {
+    std::vector <uint64_t> values;
+    for (auto & counterMeasurement : counterMeasurements)
+      values.push_back (counterMeasurement.values[counter]);
+    std::nth_element (values.begin(), values.begin() + values.size() / 2, values.end());
+    counters.values[counter] = values[values.size() / 2];
+  }
+
+  return BenchmarkResult {benchmark.name, benchmark.kind, workload.family, workload.density
+                        , workload.nNodes, workload.edges.size(), nRuns
+                        , measurements.front(), getQuantile (measurements, 0.5), getQuantile (measurements, 0.99)
+                        , counters};
+}
+
+// Function to format the counters, which are not available, as 'missing'
+static std::string formatPerfCounters (const PerfCounters & counters, const bool json) {
+  std::string text;
+  for (int counter = 0; counter < N_PERF_COUNTERS; counter++) {
+    std::string value = counters.isAvailable (PerfCounter (counter)) ? std::to_string (counters.values[counter]) : (json ? "null" : "");
+    if (json)
+      text += std::string (", \"") + getPerfCounterName (PerfCounter (counter)) + "\": " + value;
+    else
+      text += "," + value;
+  }
+  return text;
+}
+
+static void writeResults (const BenchmarkOptions & options, const std::vector <BenchmarkResult> & results) {
+  auto oFile = std::fopen (options.output.c_str(), "w");
+  if (! oFile)
+    throw std::runtime_error ("Error: Cannot create output file " + options.output);
+
+  const bool json = options.format == "json";
+  if (json)
+    std::fprintf (oFile, "[\n");
+  else
+  {
+    std::fprintf (oFile, "name,kind,family,density,nodes,edges,runs,min_ns,median_ns,p99_ns,ns_per_edge,edges_per_s,nodes_per_s");
+    for (int counter = 0; counter < N_PERF_COUNTERS; counter++)
+      std::fprintf (oFile, ",%s", getPerfCounterName (PerfCounter (counter)));
+    std::fprintf (oFile, "\n");
+  }
+
+  for (std::size_t i = 0; i < results.size(); i++) {
+    auto & r = results[i];
+    const double seconds = r.medianNs * 1e-9;
+    const double nsPerEdge = r.nEdges > 0 ? r.medianNs / r.nEdges : 0.0;
+    const double edgesPerSecond = seconds > 0 ? r.nEdges / seconds : 0.0;
+    const double nodesPerSecond = seconds > 0 ? r.nNodes / seconds : 0.0;
+
+    if (json)
+      std::fprintf (oFile, "  {\"name\": \"%s\", \"kind\": \"%s\", \"family\": \"%s\", \"density\": %g, \"nodes\": %u, \"edges\": %zu, \"runs\": %u"
+                           ", \"min_ns\": %.0f, \"median_ns\": %.0f, \"p99_ns\": %.0f, \"ns_per_edge\": %.4f, \"edges_per_s\": %.0f, \"nodes_per_s\": %.0f%s}%s\n"
+                  , r.name.c_str(), r.kind.c_str(), r.family.c_str(), r.density, r.nNodes, r.nEdges, r.nRuns
+                  , r.minNs, r.medianNs, r.p99Ns, nsPerEdge, edgesPerSecond, nodesPerSecond
+                  , formatPerfCounters (r.counters, true).c_str(), i + 1 < results.size() ? "," : "");
+    else
+      std::fprintf (oFile, "%s,%s,%s,%g,%u,%zu,%u,%.0f,%.0f,%.0f,%.4f,%.0f,%.0f%s\n"
+                  , r.name.c_str(), r.kind.c_str(), r.family.c_str(), r.density, r.nNodes, r.nEdges, r.nRuns
+                  , r.minNs, r.medianNs, r.p99Ns, nsPerEdge, edgesPerSecond, nodesPerSecond
+                  , formatPerfCounters (r.counters, false).c_str());
+  }
+
+  if (json)
+    std::fprintf (oFile, "]\n");
+
+  if (std::fclose (oFile) != 0)
+    throw std::runtime_error ("Error: Cannot write output file " + options.output);
+}
+
+static BenchmarkOptions parseOptions (int argc, char * argv[]) {
+  BenchmarkOptions options;
+  bool hasOutput = false;
+
+  for (int i = 1; i < argc; i++) {
+    std::string argument = argv[i];
+    auto value = [&]() -> std::string {
+      if (i + 1 >= argc)
+        throw std::invalid_argument ("Missing value of option " + argument);
+      return argv[++i];
+    };
+
+    if (argument == "--format")
+      options.format = value();
+    else if (argument == "--output") {
+      options.output = value();
+      hasOutput = true;
+    } else if (argument == "--runs")
+      options.nRuns = std::max (1, std::atoi (value().c_str()));
+    else if (argument == "--filter")
+      options.filter = value();
+    else if (argument == "--max-edges")
+      options.maxEdges = std::strtoull (value().c_str(), nullptr, 10);
+    else if (argument == "--quick")
+      options.quick = true;
+    else if (argument == "--trace")
+      options.trace = value();
+    else
+      throw std::invalid_argument ("Unknown option " + argument);
+  }
+
+  if (options.format != "csv" && options.format != "json")
+    throw std::invalid_argument ("Unknown format " + options.format);
+  if (! hasOutput && options.format == "json")
+    options.output = "measurements/benchmark.json";
+
+  return options;
+}
+
+int main (int argc, char * argv[]) {
+  BenchmarkOptions options;
+  try {
+    options = parseOptions (argc, argv);
+  } catch (const std::invalid_argument & e) {
+    std::cerr << e.what() << std::endl;
+    std::cerr << "usage: " << argv[0] << " [--format csv|json] [--output FILE] [--runs N] [--filter SUBSTRING] [--max-edges N] [--quick] [--trace FILE]" << std::endl;
+    return 1;
+  }
+
+  auto benchmarks = registerBenchmarks();
+  std::vector <BenchmarkResult> results;
+
+  forEachWorkload (options, [&](Workload & workload) {
+    std::printf ("%s graph: %u nodes, %zu edges\n", workload.family.c_str(), workload.nNodes, workload.edges.size());
+
+    for (auto & benchmark : benchmarks) {
+      if (workload.nNodes > benchmark.maxNodes || benchmark.name.find (options.filter) == std::string::npos)
+        continue;
+
+      results.push_back (runBenchmark (benchmark, workload, options.nRuns));
+      std::printf ("  %-32s %12.0f ns (median) %10.3f ns/edge\n", benchmark.name.c_str(), results.back().medianNs
+                 , workload.edges.empty() ? 0.0 : results.back().medianNs / workload.edges.size());
+    }
+  });
+
+  writeResults (options, results);
+  std::printf ("results written to %s\n", options.output.c_str());
+
+  if (! options.trace.empty()) {
+    if (getTraceSize() == 0)
+      std::printf ("trace is empty, the instrumentation needs 'make bench TRACE=1'\n");
+
+    auto isJSON = options.trace.size() >= 5 && options.trace.compare (options.trace.size() - 5, 5, ".json") == 0;
+    if (isJSON)
+      writeTraceChromeJSON (options.trace);
+    else
+      writeTraceCSV (options.trace);
+    std::printf ("trace written to %s\n", options.trace.c_str());
+  }
+
+  return 0;
+}
@@ -0,0 +1,279 @@
+#include "binary-edge-file.h"
+#include "MappedFile.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+
+// Function to write the node-ids of edges with a given width into a file
+template <typename NodeIdType>
+static void writeBinaryEdges (std::FILE * oFile, const std::vector <Edge> & edges) {
+  // NOTE: the edges are converted in blocks, to keep the amount of system calls small
+  const std::size_t blockSize = 1 << 16;
+  std::vector <NodeIdType> buffer (2 * blockSize);
+
+  for (std::size_t blockBgn = 0; blockBgn < edges.size(); blockBgn += blockSize) {
+    const std::size_t blockEnd = std::min (blockBgn + blockSize, edges.size());
+
+    std::size_t i = 0;
+    for (std::size_t edge = blockBgn; edge < blockEnd; edge++) {
+      buffer[i++] = edges[edge].first;
+      buffer[i++] = edges[edge].second;
+    }
+
+    if (std::fwrite (buffer.data(), sizeof (NodeIdType), i, oFile) != i)
+      throw std::runtime_error ("Error: Cannot write edges into binary file.");
+  }
+}
+
+// Function to check the header of a mapped binary edge file and to return it
+static BinaryEdgeFileHeader checkBinaryEdgeFile (const MappedFile & file, const std::string & filename) {
+  BinaryEdgeFileHeader header;
+
+  if (file.size() < sizeof (BinaryEdgeFileHeader))
+    throw std::invalid_argument ("Not a binary edge file: " + filename);
+  std::memcpy (&header, file.data(), sizeof (BinaryEdgeFileHeader));
+
+  if (std::memcmp (header.magic, BINARY_EDGE_FILE_MAGIC, sizeof (header.magic)) != 0)
+    throw std::invalid_argument ("Not a binary edge file: " + filename);
+
+  if (header.version != BINARY_EDGE_FILE_VERSION)
+    throw std::invalid_argument ("Unsupported version of the binary edge file: " + filename);
+
+  if (header.idWidth != 2 && header.idWidth != 4 && header.idWidth != 8)
+    throw std::invalid_argument ("Unsupported node-id width in the binary edge file: " + filename);
+
+  if (file.size() - sizeof (BinaryEdgeFileHeader) != header.nEdges * 2 * header.idWidth)
+    throw std::invalid_argument ("The size of the binary edge file does not fit to its header: " + filename);
+
+  // NOTE: all node-ids are in [0, nNodes), so it is sufficient to check the amount of nodes
+  if (header.nNodes > uint64_t (std::numeric_limits <unsigned int>::max()) + 1)
+    throw std::invalid_argument ("The node-ids of the binary edge file are too large: " + filename);
+
+  return header;
+}
+
+void writeEdgesToBinaryFile (const std::string & filename, const std::vector <Edge> & edges) {
+  BinaryEdgeFileHeader header;
+  std::memcpy (header.magic, BINARY_EDGE_FILE_MAGIC, sizeof (header.magic));
+  header.version = BINARY_EDGE_FILE_VERSION;
+  header.nNodes  = edges.empty() ? 0 : uint64_t (getMaxNodeId (edges)) + 1;
+  header.nEdges  = edges.size();
+  header.idWidth = header.nNodes <= (uint64_t (1) << 16) ? 2 : 4;
+
+  // determine the properties of the edges
+  // NOTE: Duplicates can only be excluded cheaply, if all the edges are sorted.
+  bool sortedBySource = true, sortedEdges = true, duplicates = false;
+  for (std::size_t i = 1; i < edges.size(); i++) {
+    sortedBySource &= edges[i - 1].first <= edges[i].first;
+    sortedEdges    &= edges[i - 1] <= edges[i];
+    duplicates     |= edges[i - 1] == edges[i];
+  }
+  header.flags = 0;
+  if (sortedBySource)
+    header.flags |= SORTED_BY_SOURCE;
+  if (sortedEdges && ! duplicates)
+    header.flags |= DEDUPLICATED;
+
+  auto oFile = std::fopen (filename.c_str(), "wb");
+  if (! oFile)
+    throw std::runtime_error ("Error: Cannot create output file " + filename);
+
+  try {
+    if (std::fwrite (&header, sizeof (BinaryEdgeFileHeader), 1, oFile) != 1)
+      throw std::runtime_error ("Error: Cannot write header into binary file " + filename);
+
+    if (header.idWidth == 2)
+      writeBinaryEdges <uint16_t> (oFile, edges);
+    else
+      writeBinaryEdges <uint32_t> (oFile, edges);
+  } catch (...) {
+    std::fclose (oFile);
+    throw;
+  }
+
+  if (std::fclose (oFile) != 0)
+    throw std::runtime_error ("Error: Cannot write binary file " + filename);
+}
+
+BinaryEdgeFileHeader readBinaryEdgeFileHeader (const std::string & filename) {
+  MappedFile file (filename, false);
+  return checkBinaryEdgeFile (file, filename);
+}
+
+std::vector <Edge> readEdgesFromBinaryFile (const std::string & filename) {
+  BinaryEdgeFileHeader header;
+  return readEdgesFromBinaryFile (filename, header);
+}
+
+std::vector <Edge> readEdgesFromBinaryFile (const std::string & filename, BinaryEdgeFileHeader & header) {
+  MappedFile file (filename);
+  header = checkBinaryEdgeFile (file, filename);
+
+  const char * payload = file.data() + sizeof (BinaryEdgeFileHeader);
+
+  std::vector <Edge> edges (header.nEdges);
+  for (std::size_t i = 0; i < edges.size(); i++)
+    edges[i] = Edge (readBinaryNodeId (payload, 2 * i, header.idWidth), readBinaryNodeId (payload, 2 * i + 1, header.idWidth));
+
+  return edges;
+}
+
+GraphCSR readGraphCSRFromBinaryFile (const std::string & filename) {
+  MappedFile file (filename);
+  auto header = checkBinaryEdgeFile (file, filename);
+
+  if (! (header.flags & SORTED_BY_SOURCE))
+    return createGraphCSRFromEdges (readEdgesFromBinaryFile (filename));
+
+  if (header.nEdges == 0)
+    return GraphCSR();
+
+  const char * payload = file.data() + sizeof (BinaryEdgeFileHeader);
+
+  // the edges are already grouped by their source node, so the targets can be copied as they
+  // are and the offsets are given by the positions where the source node changes
+  std::vector <std::size_t> offsets (header.nNodes + 1, 0);
+  std::vector <unsigned int> targets (header.nEdges);
+
+  uint64_t nodeId = 0;
+  for (std::size_t i = 0; i < targets.size(); i++) {
+    auto sourceNodeId = readBinaryNodeId (payload, 2 * i, header.idWidth);
+    auto targetNodeId = readBinaryNodeId (payload, 2 * i + 1, header.idWidth);
+    if (sourceNodeId >= header.nNodes || targetNodeId >= header.nNodes || sourceNodeId < nodeId)
+      throw std::invalid_argument ("The edges of the binary edge file do not fit to its header: " + filename);
+    
+    targets[i] = targetNodeId;
+
+    while (nodeId < sourceNodeId)
+      offsets[++nodeId] = i;
+  }
+  while (nodeId < header.nNodes)
+    offsets[++nodeId] = targets.size();
+
+  return GraphCSR (std::move (offsets), std::move (targets));
+}
+
+void convertTextToBinaryEdgeFile (const std::string & textFilename, const std::string & binaryFilename) {
+  writeEdgesToBinaryFile (binaryFilename, readEdgesFromFile (textFilename));
+}
+
+void convertBinaryToTextEdgeFile (const std::string & binaryFilename, const std::string & textFilename) {
+  auto edges = readEdgesFromBinaryFile (binaryFilename);
+
+  auto oFile = std::fopen (textFilename.c_str(), "w");
+  if (! oFile)
+    throw std::runtime_error ("Error: Cannot create output file " + textFilename);
+
+  for (auto & edge : edges)
+    std::fprintf (oFile, "%u %u\n", edge.first, edge.second);
+
+  if (std::fclose (oFile) != 0)
+    throw std::runtime_error ("Error: Cannot write text file " + textFilename);
+}
+
+void sortBinaryEdgeFileBySource (const std::string & inputFilename, const std::string & outputFilename, const std::size_t memoryBudget) {
+  MappedFile input (inputFilename);
+  auto header = checkBinaryEdgeFile (input, inputFilename);
+  const char * payload = input.data() + sizeof (BinaryEdgeFileHeader);
+  
+  // the edges are split into runs, which fit into the memory budget, every run is sorted in
+  // memory and written into a temporary binary edge file
+  const std::size_t runSize = std::max <std::size_t> (1, memoryBudget / sizeof (Edge));
+  std::vector <std::string> runFilenames;
+  
+  auto removeRuns = [&]() {
+    for (auto & runFilename : runFilenames)
+      std::remove (runFilename.c_str());
+  };
+  
+  try {
+    {
+      std::vector <Edge> run;
+      for (std::size_t runBgn = 0; runBgn < header.nEdges; runBgn += runSize) {
+        run.resize (std::min <std::size_t> (runSize, header.nEdges - runBgn));
+        for (std::size_t i = 0; i < run.size(); i++)
+          run[i] = Edge (readBinaryNodeId (payload, 2 * (runBgn + i), header.idWidth), readBinaryNodeId (payload, 2 * (runBgn + i) + 1, header.idWidth));
+        
+        std::sort (run.begin(), run.end());
+        
+        runFilenames.push_back (outputFilename + ".run" + std::to_string (runFilenames.size()));
+        writeEdgesToBinaryFile (runFilenames.back(), run);
+      }
+    }
+    
+    // the runs are merged in a single pass, the kernel pages the mapped runs in and out, so
+    // only the merge heap and the output block stay in memory
+    std::vector <std::unique_ptr <MappedFile>> runs;
+    std::vector <BinaryEdgeFileHeader> runHeaders;
+    std::vector <std::size_t> nextEdge (runFilenames.size(), 0);
+    for (auto & runFilename : runFilenames) {
+      runs.emplace_back (new MappedFile (runFilename));
+      runHeaders.push_back (checkBinaryEdgeFile (*runs.back(), runFilename));
+    }
+    
+    auto readRunEdge = [&](const std::size_t runId) {
+      const char * runPayload = runs[runId]->data() + sizeof (BinaryEdgeFileHeader);
+      const auto position = 2 * nextEdge[runId]++;
+      return Edge (readBinaryNodeId (runPayload, position, runHeaders[runId].idWidth), readBinaryNodeId (runPayload, position + 1, runHeaders[runId].idWidth));
+    };
+    
+    typedef std::pair <Edge, std::size_t> HeapEntry;
+    std::priority_queue <HeapEntry, std::vector <HeapEntry>, std::greater <HeapEntry>> heap;
+    for (std::size_t runId = 0; runId < runs.size(); runId++)
+      heap.push (HeapEntry (readRunEdge (runId), runId));
+    
+    BinaryEdgeFileHeader outputHeader = header;
+    outputHeader.idWidth = header.nNodes <= (uint64_t (1) << 16) ? 2 : 4;
+    outputHeader.flags = SORTED_BY_SOURCE | (header.flags & DEDUPLICATED);
+    
+    auto oFile = std::fopen (outputFilename.c_str(), "wb");
+    if (! oFile)
+      throw std::runtime_error ("Error: Cannot create output file " + outputFilename);
+    
+    try {
+      if (std::fwrite (&outputHeader, sizeof (BinaryEdgeFileHeader), 1, oFile) != 1)
+        throw std::runtime_error ("Error: Cannot write header into binary file " + outputFilename);
+      
+      const std::size_t blockSize = 1 << 16;
+      std::vector <Edge> block;
+      block.reserve (blockSize);
+      
+      auto writeBlock = [&]() {
+        if (outputHeader.idWidth == 2)
+          writeBinaryEdges <uint16_t> (oFile, block);
+        else
+          writeBinaryEdges <uint32_t> (oFile, block);
+        block.clear();
+      };
+      
+      while (! heap.empty()) {
+        auto entry = heap.top();
+        heap.pop();
+        
+        block.push_back (entry.first);
+        if (block.size() == blockSize)
+          writeBlock();
+        
+        if (nextEdge[entry.second] < runHeaders[entry.second].nEdges)
+          heap.push (HeapEntry (readRunEdge (entry.second), entry.second));
+      }
+      writeBlock();
+    } catch (...) {
+      std::fclose (oFile);
+      throw;
+    }
+    
+    if (std::fclose (oFile) != 0)
+      throw std::runtime_error ("Error: Cannot write binary file " + outputFilename);
+  } catch (...) {
+    removeRuns();
+    throw;
+  }
+  
+  removeRuns();
+}
@@ -0,0 +1,273 @@
+#include "external-topological-sort.h"
+#include "binary-edge-file.h"
+#include "MappedFile.h"
+#include "trace.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include <sys/types.h>
+
+// Reader of the edges of a binary edge file, which keeps one block of consecutive edges in memory
+class EdgeBlockReader {
+  std::FILE * _file;
+  const std::string & _filename;
+  const uint32_t _idWidth;
+  std::vector <char> _buffer;
+  // edges within the buffer
+  uint64_t _bgn, _end;
+  ExternalSortStatistics & _statistics;
+
+public:
+  EdgeBlockReader (const std::string & filename, const uint32_t idWidth, ExternalSortStatistics & statistics)
+    : _file (std::fopen (filename.c_str(), "rb"))
+    , _filename (filename)
+    , _idWidth (idWidth)
+    , _bgn (0)
+    , _end (0)
+    , _statistics (statistics)
+  {
+    if (! _file)
+      throw std::invalid_argument ("Cannot open file: " + filename);
+  }
+
+  ~EdgeBlockReader () {
+    std::fclose (_file);
+  }
+
+  EdgeBlockReader (const EdgeBlockReader &) = delete;
+  EdgeBlockReader & operator= (const EdgeBlockReader &) = delete;
+
+  // Function to read the edges [bgn, end) into the buffer
+  void load (const uint64_t bgn, const uint64_t end) {
+    const std::size_t nBytes = (end - bgn) * 2 * _idWidth;
+    _buffer.resize (nBytes);
+
+    if (fseeko (_file, off_t (sizeof (BinaryEdgeFileHeader) + bgn * 2 * _idWidth), SEEK_SET) != 0
+        || std::fread (_buffer.data(), 1, nBytes, _file) != nBytes)
+      throw std::runtime_error ("Error: Cannot read the edges of file " + _filename);
+
+    _bgn = bgn;
+    _end = end;
+    _statistics.nBlockReads++;
+    _statistics.nBytesRead += nBytes;
+  }
+
+  inline bool contains (const uint64_t bgn, const uint64_t end) const {
+    return _bgn <= bgn && end <= _end;
+  }
+
+  inline uint64_t source (const uint64_t edge) const {
+    return readBinaryNodeId (_buffer.data(), 2 * (edge - _bgn), _idWidth);
+  }
+
+  inline uint64_t target (const uint64_t edge) const {
+    return readBinaryNodeId (_buffer.data(), 2 * (edge - _bgn) + 1, _idWidth);
+  }
+};
+
+// Kahn1962 algorithm on a binary edge file, whose edges are sorted by their source node
+//
+// The nodes are grouped into blocks, whose edges fit into 'memoryBudget'. Every block keeps 
+// its own ready nodes. A pass reads the blocks with ready nodes in the order of the file and 
+// processes them, until none of them is ready anymore. Nodes becoming ready in another block 
+// wait for the next time this block is read, so every pass reads the file once sequentially 
+// at most. The passes are repeated until no node is ready anymore.
+static void topologicalSortSourceSortedFile (const std::string & edgeFilename, const std::string & orderFilename, const std::size_t memoryBudget, ExternalSortStatistics & statistics) {
+  auto header = readBinaryEdgeFileHeader (edgeFilename);
+  const uint64_t maxEdgesPerBlock = std::max <uint64_t> (1, memoryBudget / (2 * header.idWidth));
+
+  EdgeBlockReader reader (edgeFilename, header.idWidth, statistics);
+
+  // one pass over the edges gives the in-degrees and the offsets of the edges of each node
+  TRACE_PHASE_BEGIN (inDegree, "topologicalSortExternal:getInDegree");
+  std::vector <unsigned int> inDegree (header.nNodes, 0);
+  std::vector <uint64_t> offsets (header.nNodes + 1, 0);
+
+  uint64_t nodeId = 0;
+  for (uint64_t bgn = 0; bgn < header.nEdges; bgn += maxEdgesPerBlock) {
+    const uint64_t end = std::min (header.nEdges, bgn + maxEdgesPerBlock);
+    reader.load (bgn, end);
+
+    for (uint64_t i = bgn; i < end; i++) {
+      auto sourceNodeId = reader.source (i);
+      auto targetNodeId = reader.target (i);
+      if (sourceNodeId >= header.nNodes || targetNodeId >= header.nNodes || sourceNodeId < nodeId)
+        throw std::invalid_argument ("The edges of the binary edge file do not fit to its header: " + edgeFilename);
+
+      inDegree[targetNodeId]++;
+
+      while (nodeId < sourceNodeId)
+        offsets[++nodeId] = i;
+    }
+  }
+  while (nodeId < header.nNodes)
+    offsets[++nodeId] = header.nEdges;
+  TRACE_PHASE_END (inDegree);
+
+  // first node of every block, the last element is |V|
+  // NOTE: A node with more edges than 'maxEdgesPerBlock' is a block of its own and its edges
+  //       are read in several parts.
+  std::vector <uint64_t> blockBgn;
+  for (uint64_t bgn = 0; bgn < header.nNodes; ) {
+    blockBgn.push_back (bgn);
+    uint64_t end = bgn + 1;
+    while (end < header.nNodes && offsets[end + 1] - offsets[bgn] <= maxEdgesPerBlock)
+      end++;
+    bgn = end;
+  }
+  blockBgn.push_back (header.nNodes);
+  const std::size_t nBlocks = blockBgn.size() - 1;
+
+  auto getBlock = [&](const uint64_t nodeId) -> std::size_t {
+    return std::upper_bound (blockBgn.begin(), blockBgn.end(), nodeId) - blockBgn.begin() - 1;
+  };
+
+  // stacks of the nodes of each block with no incoming edges, which have not been processed 
+  // till now
+  std::vector <std::vector <unsigned int>> readyNodes (nBlocks);
+  uint64_t nReadyNodes = 0;
+  for (std::size_t block = 0; block < nBlocks; block++) {
+    for (uint64_t nodeId = blockBgn[block]; nodeId < blockBgn[block + 1]; nodeId++) {
+      if (inDegree[nodeId] == 0) {
+        readyNodes[block].push_back (nodeId);
+        nReadyNodes++;
+      }
+    }
+  }
+
+  auto oFile = std::fopen (orderFilename.c_str(), "wb");
+  if (! oFile)
+    throw std::runtime_error ("Error: Cannot create output file " + orderFilename);
+
+  TRACE_PHASE_BEGIN (drain, "topologicalSortExternal:drain");
+  uint64_t nodeCounter = 0;
+  try {
+    // the sorted nodes are written in blocks, to keep the amount of system calls small
+    const std::size_t orderBlockSize = 1 << 16;
+    std::vector <uint32_t> orderBlock;
+    orderBlock.reserve (orderBlockSize);
+
+    auto writeOrderBlock = [&]() {
+      if (std::fwrite (orderBlock.data(), sizeof (uint32_t), orderBlock.size(), oFile) != orderBlock.size())
+        throw std::runtime_error ("Error: Cannot write the sorting into file " + orderFilename);
+      orderBlock.clear();
+    };
+
+    while (nReadyNodes > 0) {
+      statistics.nPasses++;
+
+      for (std::size_t block = 0; block < nBlocks; block++) {
+        auto & S = readyNodes[block];
+        if (S.empty())
+          continue;
+
+        // the edges of the whole block are read at once, if they fit
+        const uint64_t blockEdgesBgn = offsets[blockBgn[block]];
+        const uint64_t blockEdgesEnd = std::min (offsets[blockBgn[block + 1]], blockEdgesBgn + maxEdgesPerBlock);
+        if (blockEdgesBgn < blockEdgesEnd && ! reader.contains (blockEdgesBgn, blockEdgesEnd))
+          reader.load (blockEdgesBgn, blockEdgesEnd);
+
+        while (! S.empty()) {
+          auto n = S.back();
+          S.pop_back();
+          nReadyNodes--;
+
+          orderBlock.push_back (n);
+          if (orderBlock.size() == orderBlockSize)
+            writeOrderBlock();
+          nodeCounter++;
+
+          // delete n as precondition (incoming edge) from all its successors
+          for (auto bgn = offsets[n]; bgn < offsets[n + 1]; bgn += maxEdgesPerBlock) {
+            const uint64_t end = std::min (offsets[n + 1], bgn + maxEdgesPerBlock);
+            // NOTE: Only the edges of a node larger than the budget are read in several parts.
+            if (! reader.contains (bgn, end))
+              reader.load (bgn, end);
+
+            for (auto edge = bgn; edge < end; edge++) {
+              auto targetNodeId = reader.target (edge);
+              if (--inDegree[targetNodeId] != 0)
+                continue;
+
+              const bool isInBlock = blockBgn[block] <= targetNodeId && targetNodeId < blockBgn[block + 1];
+              readyNodes[isInBlock ? block : getBlock (targetNodeId)].push_back (targetNodeId);
+              nReadyNodes++;
+            }
+          }
+        }
+
+        // the stacks of the other blocks need the memory
+        std::vector <unsigned int> ().swap (S);
+      }
+    }
+    writeOrderBlock();
+  } catch (...) {
+    std::fclose (oFile);
+    std::remove (orderFilename.c_str());
+    throw;
+  }
+
+  TRACE_PHASE_END (drain);
+  TRACE_COUNTER ("topologicalSortExternal:passes", statistics.nPasses);
+  
+  if (std::fclose (oFile) != 0) {
+    std::remove (orderFilename.c_str());
+    throw std::runtime_error ("Error: Cannot write the sorting into file " + orderFilename);
+  }
+
+  // if not all nodes could be sorted, there has been a cycle
+  if (nodeCounter != header.nNodes) {
+    std::remove (orderFilename.c_str());
+    throw std::invalid_argument ("The given graph is not (D)irected (A)cyclic (G)raph");
+  }
+}
+
+void topologicalSortExternal (const std::string & edgeFilename, const std::string & orderFilename, const std::size_t memoryBudget) {
+  ExternalSortStatistics statistics;
+  topologicalSortExternal (edgeFilename, orderFilename, memoryBudget, statistics);
+}
+
+void topologicalSortExternal (const std::string & edgeFilename, const std::string & orderFilename, const std::size_t memoryBudget, ExternalSortStatistics & statistics) {
+  TRACE_SCOPE ("topologicalSortExternal");
+  
+  statistics = ExternalSortStatistics();
+  auto header = readBinaryEdgeFileHeader (edgeFilename);
+
+  if (header.flags & SORTED_BY_SOURCE) {
+    topologicalSortSourceSortedFile (edgeFilename, orderFilename, memoryBudget, statistics);
+    return;
+  }
+
+  const std::string sortedFilename = orderFilename + ".sorted";
+  try {
+    TRACE_PHASE_BEGIN (sort, "topologicalSortExternal:sortBySource");
+    sortBinaryEdgeFileBySource (edgeFilename, sortedFilename, memoryBudget);
+    TRACE_PHASE_END (sort);
+    topologicalSortSourceSortedFile (sortedFilename, orderFilename, memoryBudget, statistics);
+  } catch (...) {
+    std::remove (sortedFilename.c_str());
+    throw;
+  }
+
+  std::remove (sortedFilename.c_str());
+}
+
+std::vector <unsigned int> readTopologicalSortingFromFile (const std::string & orderFilename) {
+  MappedFile file (orderFilename);
+
+  if (file.size() % sizeof (uint32_t) != 0)
+    throw std::invalid_argument ("Not a file of a sorting: " + orderFilename);
+
+  std::vector <unsigned int> sorting (file.size() / sizeof (uint32_t));
+  for (std::size_t i = 0; i < sorting.size(); i++) {
+    uint32_t nodeId;
+    std::memcpy (&nodeId, file.data() + i * sizeof (uint32_t), sizeof (uint32_t));
+    sorting[i] = nodeId;
+  }
+
+  return sorting;
+}
@@ -1,5 +1,11 @@
 #include "meter.h"
 
+#include <cstring>
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
 template <>
 Matrix <double> normalizeMeasurements (const Matrix <timeDuration> & measurements) {
   Matrix <double> normMeasurements (measurements.rows(), measurements.cols(), 0);
@@ -95,3 +101,105 @@ uint64_t myCycles ( void ) {
   return rdtsc();
 }
 
+
+// This class keeps the file descriptors of the opened hardware performance counters
+class PerfEvents {
+  int _fds[N_PERF_COUNTERS];
+
+  // function to open a single counter, -1 is returned if it is not available
+  static int open (const uint32_t type, const uint64_t config) {
+    perf_event_attr attributes;
+    std::memset (&attributes, 0, sizeof (attributes));
+    attributes.size = sizeof (attributes);
+    attributes.type = type;
+    attributes.config = config;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    attributes.inherit = 1;
+    attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return syscall (__NR_perf_event_open, &attributes, 0, -1, -1, 0);
+  }
+
+public:
+  PerfEvents () {
+    const uint64_t dtlbReadMisses = PERF_COUNT_HW_CACHE_DTLB
+                                  | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                  | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+    _fds[PERF_CYCLES]        = open (PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    _fds[PERF_INSTRUCTIONS]  = open (PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    _fds[PERF_LLC_MISSES]    = open (PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    _fds[PERF_BRANCH_MISSES] = open (PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    _fds[PERF_DTLB_MISSES]   = open (PERF_TYPE_HW_CACHE, dtlbReadMisses);
+  }
+
+  ~PerfEvents () {
+    for (auto fd : _fds)
+      if (fd >= 0)
+        close (fd);
+  }
+
+  PerfEvents (const PerfEvents &) = delete;
+  PerfEvents & operator= (const PerfEvents &) = delete;
+
+  PerfCounters read (void) const {
+    PerfCounters counters;
+
+    for (int i = 0; i < N_PERF_COUNTERS; i++) {
+      // value, time enabled, time running
+      uint64_t data[3];
+      if (_fds[i] < 0 || ::read (_fds[i], data, sizeof (data)) != sizeof (data))
+        continue;
+
+      // NOTE: A multiplexed counter only runs part of the time, so its value is extrapolated.
+      if (data[2] > 0 && data[2] < data[1])
+        data[0] = uint64_t (double (data[0]) * data[1] / data[2]);
+
+      counters.values[i] = data[0];
+      counters.available |= 1u << i;
+    }
+
+    return counters;
+  }
+
+  bool isAnyAvailable (void) const {
+    for (auto fd : _fds)
+      if (fd >= 0)
+        return true;
+    return false;
+  }
+};
+
+static const PerfEvents & getPerfEvents (void) {
+  static PerfEvents perfEvents;
+  return perfEvents;
+}
+
+PerfCounters myPerfCounters (void) {
+  return getPerfEvents().read();
+}
+
+bool hasPerfCounters (void) {
+  return getPerfEvents().isAnyAvailable();
+}
+
+const char * getPerfCounterName (const PerfCounter counter) {
+  switch (counter) {
+    case PERF_CYCLES:        return "cycles";
+    case PERF_INSTRUCTIONS:  return "instructions";
+    case PERF_LLC_MISSES:    return "llc_misses";
+    case PERF_BRANCH_MISSES: return "branch_misses";
+    case PERF_DTLB_MISSES:   return "dtlb_misses";
+    default:                 throw std::invalid_argument ("Error: Unknown performance counter.");
+  }
+}
+
+Matrix <uint64_t> selectPerfCounter (const Matrix <PerfCounters> & measurements, const PerfCounter counter) {
+  Matrix <uint64_t> counterMeasurements (measurements.rows(), measurements.cols(), 0);
+
+  for (uint i = 0; i < measurements.rows(); i++) for (uint j = 0; j < measurements.cols(); j++)
+    counterMeasurements(i,j) = measurements(i,j)[counter];
+
+  return counterMeasurements;
+}
@@ -0,0 +1,211 @@
+#include "random-dag.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+// Function to draw the amount of pairs to skip before the next edge, if every pair is an edge
+// with probability p [geometric distribution]
+//
+// 'logQ' has to be log(1 - p). The distance is clamped to 'maxGap'.
+static inline uint64_t nextGap (RandomGenerator & random, const double logQ, const uint64_t maxGap) {
+  // NOTE: 1 - nextDouble() is in (0, 1], so the logarithm is finite
+  const double gap = std::floor (std::log (1.0 - random.nextDouble()) / logQ);
+  return gap < double (maxGap) ? uint64_t (gap) : maxGap;
+}
+
+// Function to call 'addEdge' for every edge (bgn + i, bgn + j), i > j, of the nodes
+// [bgn, bgn + nNodes), which exists with probability 'epsilon'
+//
+// The edges are generated ordered by their source and target node.
+template <typename AddEdge>
+static void sampleLowerTriangle (const unsigned int bgn, const unsigned int nNodes, const double epsilon, RandomGenerator & random, AddEdge addEdge) {
+  if (nNodes < 2 || epsilon <= 0)
+    return;
+
+  const double logQ = std::log1p (-std::min (epsilon, 1.0));
+  const uint64_t maxGap = uint64_t (nNodes) * nNodes;
+
+  // position (i, j) of the next pair within the lower triangle
+  uint64_t i = 1, j = nextGap (random, logQ, maxGap);
+  while (true) {
+    while (j >= i) {
+      j -= i;
+      if (++i >= nNodes)
+        return;
+    }
+
+    addEdge (bgn + i, bgn + j);
+    j += 1 + nextGap (random, logQ, maxGap);
+  }
+}
+
+// Function to call 'addEdge' for every edge from [sourceBgn, sourceBgn + nSources) to
+// [targetBgn, targetBgn + nTargets), which exists with probability 'epsilon'
+template <typename AddEdge>
+static void sampleRectangle (const unsigned int sourceBgn, const unsigned int nSources, const unsigned int targetBgn, const unsigned int nTargets
+                           , const double epsilon, RandomGenerator & random, AddEdge addEdge) {
+  if (nSources == 0 || nTargets == 0 || epsilon <= 0)
+    return;
+
+  const double logQ = std::log1p (-std::min (epsilon, 1.0));
+  const uint64_t nPairs = uint64_t (nSources) * nTargets;
+
+  for (uint64_t pair = nextGap (random, logQ, nPairs); pair < nPairs; pair += 1 + nextGap (random, logQ, nPairs))
+    addEdge (sourceBgn + pair / nTargets, targetBgn + pair % nTargets);
+}
+
+// Function to give the expected amount of edges of 'createRandomDAGEdges'
+static std::size_t getExpectedNumberOfEdges (const unsigned int nNodes, const double epsilon) {
+  return std::size_t (std::max (0.0, std::min (epsilon, 1.0)) * (double (nNodes) * (double (nNodes) - 1) / 2));
+}
+
+std::vector <Edge> createRandomDAGEdges (const unsigned int nNodes, const double epsilon, const uint64_t seed) {
+  RandomGenerator random (seed);
+
+  std::vector <Edge> edges;
+  edges.reserve (getExpectedNumberOfEdges (nNodes, epsilon));
+
+  sampleLowerTriangle (0, nNodes, epsilon, random, [&](unsigned int sourceNodeId, unsigned int targetNodeId) {
+    edges.push_back (Edge (sourceNodeId, targetNodeId));
+  });
+
+  return edges;
+}
+
+GraphCSR createRandomDAGCSR (const unsigned int nNodes, const double epsilon, const uint64_t seed) {
+  RandomGenerator random (seed);
+
+  std::vector <std::size_t> offsets (std::size_t (nNodes) + 1, 0);
+  std::vector <unsigned int> targets;
+  targets.reserve (getExpectedNumberOfEdges (nNodes, epsilon));
+
+  // the offsets are set, whenever the source node changes
+  unsigned int nodeId = 0;
+  sampleLowerTriangle (0, nNodes, epsilon, random, [&](unsigned int sourceNodeId, unsigned int targetNodeId) {
+    while (nodeId < sourceNodeId)
+      offsets[++nodeId] = targets.size();
+    targets.push_back (targetNodeId);
+  });
+  while (nodeId < nNodes)
+    offsets[++nodeId] = targets.size();
+
+  return GraphCSR (std::move (offsets), std::move (targets));
+}
+
+// Function to create the edges of the nodes [bgn, bgn + nNodes) for 'createMoreRandomDAGEdges'
+static void createMoreRandomDAGEdges (const unsigned int bgn, const unsigned int nNodes, const double epsilon, const unsigned int minGroupSize
+                                    , RandomGenerator & random, std::vector <Edge> & edges) {
+  auto addEdge = [&](unsigned int sourceNodeId, unsigned int targetNodeId) {
+    edges.push_back (Edge (sourceNodeId, targetNodeId));
+  };
+
+  const unsigned int half = nNodes / 2;
+
+  if (nNodes > 2 * minGroupSize) {
+    createMoreRandomDAGEdges (bgn, half, epsilon, minGroupSize, random, edges);
+    createMoreRandomDAGEdges (bgn + half, nNodes - half, epsilon, minGroupSize, random, edges);
+  } else {
+    sampleLowerTriangle (bgn, half, epsilon, random, addEdge);
+    sampleLowerTriangle (bgn + half, nNodes - half, epsilon, random, addEdge);
+  }
+
+  sampleRectangle (bgn, half, bgn + half, nNodes - half, epsilon, random, addEdge);
+}
+
+std::vector <Edge> createMoreRandomDAGEdges (const unsigned int nNodes, const double epsilon, const uint64_t seed, const unsigned int minGroupSize) {
+  RandomGenerator random (seed);
+
+  std::vector <Edge> edges;
+  createMoreRandomDAGEdges (0, nNodes, epsilon, std::max (1u, minGroupSize), random, edges);
+
+  return edges;
+}
+
+std::vector <Edge> createChainDAGEdges (const unsigned int nNodes) {
+  std::vector <Edge> edges;
+  edges.reserve (nNodes);
+
+  for (unsigned int nodeId = 1; nodeId < nNodes; nodeId++)
+    edges.push_back (Edge (nodeId - 1, nodeId));
+
+  return edges;
+}
+
+std::vector <Edge> createTreeDAGEdges (const unsigned int nNodes, const uint64_t seed) {
+  RandomGenerator random (seed);
+
+  std::vector <Edge> edges;
+  edges.reserve (nNodes);
+
+  for (unsigned int nodeId = 1; nodeId < nNodes; nodeId++)
+    edges.push_back (Edge (random.nextBounded (nodeId), nodeId));
+
+  return edges;
+}
+
+std::vector <Edge> createLayeredDAGEdges (const unsigned int nLayers, const unsigned int layerSize, const unsigned int nEdgesPerNode, const uint64_t seed) {
+  RandomGenerator random (seed);
+
+  std::vector <Edge> edges;
+  if (nLayers > 1)
+    edges.reserve (std::size_t (nLayers - 1) * layerSize * nEdgesPerNode);
+
+  for (unsigned int layer = 0; layer + 1 < nLayers; layer++)
+    for (unsigned int i = 0; i < layerSize; i++)
+      for (unsigned int j = 0; j < nEdgesPerNode; j++)
+        edges.push_back (Edge (layer * layerSize + i, (layer + 1) * layerSize + random.nextBounded (layerSize)));
+
+  return edges;
+}
+
+std::vector <Edge> createPowerLawDAGEdges (const unsigned int nNodes, const unsigned int nEdgesPerNode, const uint64_t seed) {
+  RandomGenerator random (seed);
+
+  std::vector <Edge> edges;
+  edges.reserve (std::size_t (nNodes) * nEdgesPerNode);
+
+  // every node occurs here once per edge, so drawing from it prefers the nodes with many edges
+  std::vector <unsigned int> endpoints;
+  endpoints.reserve (2 * std::size_t (nNodes) * nEdgesPerNode);
+
+  for (unsigned int nodeId = 1; nodeId < nNodes; nodeId++) {
+    const std::size_t firstEdge = edges.size();
+
+    for (unsigned int i = 0; i < std::min (nodeId, nEdgesPerNode); i++) {
+      // NOTE: Every node gets one more chance, so nodes without edges can be drawn as well.
+      auto r = random.nextBounded (endpoints.size() + nodeId);
+      unsigned int sourceNodeId = r < endpoints.size() ? endpoints[r] : r - endpoints.size();
+
+      // a node is drawn at most once per node
+      bool isDuplicate = false;
+      for (auto edge = firstEdge; edge < edges.size(); edge++)
+        isDuplicate |= edges[edge].first == sourceNodeId;
+      if (! isDuplicate)
+        edges.push_back (Edge (sourceNodeId, nodeId));
+    }
+
+    for (auto edge = firstEdge; edge < edges.size(); edge++) {
+      endpoints.push_back (edges[edge].first);
+      endpoints.push_back (edges[edge].second);
+    }
+  }
+
+  return edges;
+}
+
+void permuteNodeIds (std::vector <Edge> & edges, const unsigned int nNodes, const uint64_t seed) {
+  RandomGenerator random (seed);
+
+  // Fisher-Yates shuffle
+  std::vector <unsigned int> permutation (nNodes);
+  std::iota (permutation.begin(), permutation.end(), 0);
+  for (unsigned int i = nNodes; i > 1; i--)
+    std::swap (permutation[i - 1], permutation[random.nextBounded (i)]);
+
+  for (auto & edge : edges) {
+    if (edge.first >= nNodes || edge.second >= nNodes)
+      throw std::invalid_argument ("Array index out of bounds.");
+    edge = Edge (permutation[edge.first], permutation[edge.second]);
+  }
+}
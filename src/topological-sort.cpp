@@ -1,12 +1,137 @@
 #include "topological-sort.h"
+#include "MappedFile.h"
+#include "parallel.h"
+#include "trace.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <mutex>
+#include <numeric>
 #include <set>
 #include <stack>
 #include <streambuf>
 #include <sstream>
+#include <thread>
+
+// Function to build the message of a 'GraphCycleException', long cycles are shortened
+template <typename NodeId>
+static std::string getCycleMessage (const std::vector <NodeId> & cycle) {
+  const std::size_t maxPrintedNodes = 16;
+  
+  std::string message = "The given graph is not (D)irected (A)cyclic (G)raph";
+  if (cycle.empty())
+    return message;
+  
+  message += ", cycle: ";
+  for (std::size_t i = 0; i < cycle.size() && i < maxPrintedNodes; i++)
+    message += std::to_string (uint64_t (cycle[i])) + " -> ";
+  if (cycle.size() > maxPrintedNodes)
+    message += "... -> ";
+  message += std::to_string (uint64_t (cycle.front()));
+  
+  return message;
+}
+
+template <typename NodeId>
+BasicGraphCycleException <NodeId>::BasicGraphCycleException (std::vector <NodeId> cycle)
+  : std::invalid_argument (getCycleMessage (cycle))
+  , _cycle (std::move (cycle)) {}
+
+// Function to give the cycle closed by a back edge to 'targetNodeId', which is on the stack
+template <typename NodeId, typename AdjacencyIterator>
+static std::vector <NodeId> getCycleFromStack (const std::vector <SearchFrame <NodeId, AdjacencyIterator>> & stack, const NodeId targetNodeId) {
+  auto frame = stack.end();
+  while ((--frame)->nodeId != targetNodeId) {}
+  
+  std::vector <NodeId> cycle;
+  for ( ; frame != stack.end(); ++frame)
+    cycle.push_back (frame->nodeId);
+  
+  return cycle;
+}
+
+// Depth-first search, which stops at the first back edge and returns the closed cycle, used 
+// for every graph type, which gives a range of target nodes for 'dag[n]'
+//
+// Only the nodes fulfilling 'isCandidate' are searched. The sorting functions pass the nodes,
+// which could not be sorted, so only the residual graph is searched.
+template <typename DAG, typename Predicate>
+static std::vector <typename DAG::NodeIdType> findCycleImpl (const DAG & dag, Predicate isCandidate) {
+  typedef typename DAG::NodeIdType NodeId;
+  typedef decltype (dag[0].begin()) AdjacencyIterator;
+  
+  std::vector <NodeColor> nodeColors (dag.nNodes(), NodeColor::UNMARKED);
+  std::vector <SearchFrame <NodeId, AdjacencyIterator>> stack;
+  
+  for (NodeId rootNodeId = 0; rootNodeId < dag.nNodes(); rootNodeId++) {
+    if (nodeColors[rootNodeId] != NodeColor::UNMARKED || ! isCandidate (rootNodeId))
+      continue;
+    
+    nodeColors[rootNodeId] = NodeColor::TEMPORARILY_MARKED;
+    stack.push_back ({rootNodeId, dag[rootNodeId].begin(), dag[rootNodeId].end()});
+    
+    while (! stack.empty()) {
+      auto & frame = stack.back();
+      
+      if (frame.nextEdge == frame.endEdge) {
+        nodeColors[frame.nodeId] = NodeColor::PERMANENTLY_MARKED;
+        stack.pop_back();
+        continue;
+      }
+      
+      NodeId targetNodeId = *(frame.nextEdge);
+      ++frame.nextEdge;
+      
+      if (! isCandidate (targetNodeId))
+        continue;
+      
+      if (nodeColors[targetNodeId] == NodeColor::TEMPORARILY_MARKED)
+        return getCycleFromStack (stack, targetNodeId);
+      
+      if (nodeColors[targetNodeId] == NodeColor::UNMARKED) {
+        nodeColors[targetNodeId] = NodeColor::TEMPORARILY_MARKED;
+        stack.push_back ({targetNodeId, dag[targetNodeId].begin(), dag[targetNodeId].end()});
+      }
+    }
+  }
+  
+  return std::vector <NodeId> ();
+}
+
+// Function to throw a 'GraphCycleException' for a graph, which could not be sorted by Kahn's
+// algorithm
+//
+// NOTE: Every node with a remaining in-degree has a predecessor, which could not be sorted as
+//       well, so the residual graph always contains a cycle.
+template <typename DAG, typename InDegree>
+[[noreturn]] static void throwResidualCycle (const DAG & dag, const InDegree & inDegree) {
+  typedef typename DAG::NodeIdType NodeId;
+  throw BasicGraphCycleException <NodeId> (findCycleImpl (dag, [&](NodeId nodeId) { return inDegree[nodeId] > 0; }));
+}
+
+// Functions to compute the in-degrees of all nodes into 'inDegree', which keeps its capacity
+template <typename DAG>
+static void getInDegreeInto (const DAG & dag, std::vector <std::size_t> & inDegree) {
+  inDegree.assign (dag.nNodes(), 0);
+  
+  for (std::size_t sourceNodeId = 0; sourceNodeId < dag.nNodes(); sourceNodeId++)
+    for (auto targetNodeId : dag[sourceNodeId])
+      inDegree[targetNodeId]++;
+}
+
+template <typename NodeId>
+static void getInDegreeInto (const BasicGraphCSR <NodeId> & dag, std::vector <std::size_t> & inDegree) {
+  inDegree.assign (dag.nNodes(), 0);
+  
+  for (auto targetNodeId : dag.targets())
+    inDegree[targetNodeId]++;
+}
 
 // IMPLEMENTATIONS OF THE TOPOLOGICAL SORTING
 std::vector <unsigned int> topologicalSort (Graph dag) {
@@ -56,6 +181,40 @@ std::vector <unsigned int> topologicalSort (Graph dag) {
   return L;
 }
 
+std::vector <unsigned int> topologicalSortBitMatrix (const BitMatrix & dag) {
+  auto inDegree = getInDegree (dag);
+  
+  // list which will contain the sorted vertex-indices
+  // NOTE: The nodes in L[nodeCounter, nReadyNodes) are the ones with no incoming edges,
+  //       which have not been processed till now.
+  std::vector <unsigned int> L (dag.nNodes());
+  unsigned int nodeCounter = 0, nReadyNodes = 0;
+  
+  for (unsigned int nodeId = 0; nodeId < dag.nNodes(); nodeId++)
+    if (inDegree[nodeId] == 0)
+      L[nReadyNodes++] = nodeId;
+  
+  while (nodeCounter < nReadyNodes) {
+    auto n = L[nodeCounter++];
+    
+    // delete n as precondition (incoming edge) from every node m with a bit in row n
+    auto row = dag.row (n);
+    for (std::size_t word = 0; word < dag.nWords(); word++) {
+      for (uint64_t bits = row[word]; bits != 0; bits &= bits - 1) {
+        unsigned int m = word * 64 + __builtin_ctzll (bits);
+        if (--inDegree[m] == 0)
+          L[nReadyNodes++] = m;
+      }
+    }
+  }
+  
+  // if not all nodes could be sorted, there has been a cycle
+  if (nodeCounter != dag.nNodes())
+    throwResidualCycle (dag, inDegree);
+  
+  return L;
+}
+
 std::vector <unsigned int> topologicalSortAdjList (GraphAdjList posDag, GraphAdjList negDag) {
   // if the matrix is empty, it is considered to be a valid DAG and an empty list is
   // returned
@@ -147,24 +306,34 @@ std::vector <unsigned int> topologicalSortAdjList2 (GraphAdjList posDag, GraphAd
 }
 
 std::vector <unsigned int> topologicalSortAdjList3 (GraphAdjList dag) {
+  TRACE_SCOPE ("topologicalSortAdjList3");
+  
   // if the matrix is empty, it is considered to be a valid DAG and an empty list is
   // returned
   if (dag.isEmpty())
     return std::vector <unsigned int> ();
   
+  TRACE_PHASE_BEGIN (inDegree, "topologicalSortAdjList3:getInDegree");
   auto inDegree = getInDegree (dag);
+  TRACE_PHASE_END (inDegree);
   
   // list which will contain the sorted vertex-indices
   std::vector <unsigned int> L (dag.nNodes());
   unsigned int nodeCounter = 0;
   
   // set of vertices with no incoming edges
+  TRACE_PHASE_BEGIN (seed, "topologicalSortAdjList3:seed");
   std::stack <unsigned int> S;
   for (size_t nodeId = 0; nodeId < dag.nNodes(); nodeId++)
     if (inDegree[nodeId] == 0)
       S.push (nodeId);
+  TRACE_PHASE_END (seed);
   
+  TRACE_PHASE_BEGIN (drain, "topologicalSortAdjList3:drain");
+  TRACE_LOCAL_COUNTER (nRelaxedEdges);
+  TRACE_LOCAL_COUNTER (maxReadyNodes);
   while (! S.empty()) {
+    TRACE_UPDATE_MAX (maxReadyNodes, S.size());
     auto n = S.top();
     S.pop();
     
@@ -172,6 +341,7 @@ std::vector <unsigned int> topologicalSortAdjList3 (GraphAdjList dag) {
     
     // get the adjacency list for the current vertex and delete all edges from n to m
     while (! dag[n].empty()) {
+      TRACE_INCREMENT (nRelaxedEdges);
       // delete n as precondition (incoming edge) from m
       inDegree[dag[n].front()]--;
       // check whether m has still incoming edges
@@ -181,10 +351,16 @@ std::vector <unsigned int> topologicalSortAdjList3 (GraphAdjList dag) {
       dag[n].pop_front();
     }
   }
+  TRACE_PHASE_END (drain);
+  TRACE_COUNTER ("topologicalSortAdjList3:relaxedEdges", nRelaxedEdges);
+  TRACE_COUNTER ("topologicalSortAdjList3:maxReadyNodes", maxReadyNodes);
   
   // if the graph still has edges, there has been a cycle
+  // NOTE: Only the edges of sorted nodes have been deleted, so the residual graph is intact.
+  TRACE_PHASE_BEGIN (check, "topologicalSortAdjList3:isEmpty");
   if (! dag.isEmpty())
-    throw std::invalid_argument ("The given graph is not (D)irected (A)cyclic (G)raph");
+    throwResidualCycle (dag, inDegree);
+  TRACE_PHASE_END (check);
   
   return L;    
 }
@@ -231,6 +407,623 @@ std::vector <unsigned int> topologicalSortCormanAdjList2 (const GraphAdjList & p
   return L;
 }
 
+// Kahn1962 algorithm on a read-only graph, used for every graph type, which gives a range of 
+// target nodes for 'dag[n]'
+//
+// NOTE: 'inDegree' is only a buffer, so callers sorting many graphs can reuse its memory.
+template <typename DAG>
+static std::vector <typename DAG::NodeIdType> topologicalSortKahn (const DAG & dag, std::vector <std::size_t> & inDegree) {
+  typedef typename DAG::NodeIdType NodeId;
+  
+  TRACE_SCOPE ("topologicalSortKahn");
+  
+  TRACE_PHASE_BEGIN (inDegree, "topologicalSortKahn:getInDegree");
+  getInDegreeInto (dag, inDegree);
+  TRACE_PHASE_END (inDegree);
+  
+  // list which will contain the sorted vertex-indices
+  // NOTE: The nodes in L[nodeCounter, nReadyNodes) are the ones with no incoming edges,
+  //       which have not been processed till now.
+  std::vector <NodeId> L (dag.nNodes());
+  std::size_t nodeCounter = 0, nReadyNodes = 0;
+  
+  TRACE_PHASE_BEGIN (seed, "topologicalSortKahn:seed");
+  for (NodeId nodeId = 0; nodeId < dag.nNodes(); nodeId++)
+    if (inDegree[nodeId] == 0)
+      L[nReadyNodes++] = nodeId;
+  TRACE_PHASE_END (seed);
+  
+  TRACE_PHASE_BEGIN (drain, "topologicalSortKahn:drain");
+  TRACE_LOCAL_COUNTER (nRelaxedEdges);
+  TRACE_LOCAL_COUNTER (maxReadyNodes);
+  while (nodeCounter < nReadyNodes) {
+    TRACE_UPDATE_MAX (maxReadyNodes, nReadyNodes - nodeCounter);
+    auto n = L[nodeCounter++];
+    
+    // delete n as precondition (incoming edge) from all its successors
+    for (auto targetNodeId : dag[n]) {
+      TRACE_INCREMENT (nRelaxedEdges);
+      if (--inDegree[targetNodeId] == 0)
+        L[nReadyNodes++] = targetNodeId;
+    }
+  }
+  TRACE_PHASE_END (drain);
+  TRACE_COUNTER ("topologicalSortKahn:relaxedEdges", nRelaxedEdges);
+  TRACE_COUNTER ("topologicalSortKahn:maxReadyNodes", maxReadyNodes);
+  
+  // if not all nodes could be sorted, there has been a cycle
+  if (nodeCounter != dag.nNodes())
+    throwResidualCycle (dag, inDegree);
+  
+  return L;
+}
+
+template <typename DAG>
+static std::vector <typename DAG::NodeIdType> topologicalSortKahn (const DAG & dag) {
+  std::vector <std::size_t> inDegree;
+  return topologicalSortKahn (dag, inDegree);
+}
+
+// Kahn1962 algorithm, which keeps track of the levels, used for every graph type
+template <typename DAG>
+static BasicTopologicalLevels <typename DAG::NodeIdType> topologicalSortLevelsImpl (const DAG & dag) {
+  typedef typename DAG::NodeIdType NodeId;
+  
+  auto inDegree = getInDegree (dag);
+  
+  BasicTopologicalLevels <NodeId> levels;
+  levels.levelOffsets.push_back (0);
+  
+  // NOTE: Like in 'topologicalSortKahn' the nodes in L[nodeCounter, nReadyNodes) are the 
+  //       zero-degree nodes, which have not been processed till now.
+  auto & L = levels.nodes;
+  L.resize (dag.nNodes());
+  std::size_t nodeCounter = 0, nReadyNodes = 0;
+  
+  for (NodeId nodeId = 0; nodeId < dag.nNodes(); nodeId++)
+    if (inDegree[nodeId] == 0)
+      L[nReadyNodes++] = nodeId;
+  
+  while (nodeCounter < nReadyNodes) {
+    // all nodes, which are ready now, form the current level
+    const auto levelEnd = nReadyNodes;
+    
+    while (nodeCounter < levelEnd) {
+      auto n = L[nodeCounter++];
+      
+      for (auto targetNodeId : dag[n])
+        if (--inDegree[targetNodeId] == 0)
+          L[nReadyNodes++] = targetNodeId;
+    }
+    
+    levels.levelOffsets.push_back (levelEnd);
+  }
+  
+  // if not all nodes could be sorted, there has been a cycle
+  if (nodeCounter != dag.nNodes())
+    throwResidualCycle (dag, inDegree);
+  
+  return levels;
+}
+
+template <typename NodeId>
+BasicTopologicalLevels <NodeId> topologicalSortLevels (const BasicGraphAdjList <NodeId> & dag) {
+  return topologicalSortLevelsImpl (dag);
+}
+
+template <typename NodeId>
+BasicTopologicalLevels <NodeId> topologicalSortLevels (const BasicGraphCSR <NodeId> & dag) {
+  return topologicalSortLevelsImpl (dag);
+}
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortAdjList4 (const BasicGraphAdjList <NodeId> & dag) {
+  return topologicalSortKahn (dag);
+}
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortAdjList4 (const BasicGraphAdjList <NodeId> & dag, SortScratch <BasicGraphAdjList <NodeId>> & scratch) {
+  return topologicalSortKahn (dag, scratch.inDegree);
+}
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortCSR (const BasicGraphCSR <NodeId> & dag) {
+  return topologicalSortKahn (dag);
+}
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortCSR (const BasicGraphCSR <NodeId> & dag, SortScratch <BasicGraphCSR <NodeId>> & scratch) {
+  return topologicalSortKahn (dag, scratch.inDegree);
+}
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortCompressed (const BasicGraphCompressed <NodeId> & dag) {
+  return topologicalSortKahn (dag);
+}
+
+// Set of the node-ids [0, n), which gives its smallest element fast [hierarchical bitset]
+//
+// Level 0 has one bit per node, every bit of level i + 1 tells, whether the corresponding
+// word of level i is not zero. The last level is a single word, so the smallest element is
+// found by walking down from it, using count-trailing-zeros on one word per level.
+class HierarchicalBitset {
+  std::vector <std::vector <uint64_t>> _levels;
+  
+public:
+  HierarchicalBitset (const std::size_t n) {
+    std::size_t nWords = std::max <std::size_t> (1, (n + 63) / 64);
+    _levels.push_back (std::vector <uint64_t> (nWords, 0));
+    while (nWords > 1) {
+      nWords = (nWords + 63) / 64;
+      _levels.push_back (std::vector <uint64_t> (nWords, 0));
+    }
+  }
+  
+  inline bool empty (void) const {
+    return _levels.back()[0] == 0;
+  }
+  
+  void insert (std::size_t i) {
+    for (auto & level : _levels) {
+      auto & word = level[i / 64];
+      const bool wasEmpty = word == 0;
+      word |= uint64_t (1) << (i % 64);
+      // the bits of the upper levels are already set
+      if (! wasEmpty)
+        return;
+      i /= 64;
+    }
+  }
+  
+  // remove the smallest element and give it, the set must not be empty
+  std::size_t popMin (void) {
+    std::size_t i = 0;
+    for (auto level = _levels.size(); level-- > 0; )
+      i = i * 64 + __builtin_ctzll (_levels[level][i]);
+    
+    const std::size_t min = i;
+    for (auto & level : _levels) {
+      auto & word = level[i / 64];
+      word &= word - 1;
+      // the word of the upper level keeps its bit, as long as the word is not empty
+      if (word != 0)
+        break;
+      i /= 64;
+    }
+    
+    return min;
+  }
+};
+
+// Kahn1962 algorithm taking the smallest zero-degree node first, used for every graph type
+template <typename DAG>
+static std::vector <typename DAG::NodeIdType> topologicalSortLexMinImpl (const DAG & dag) {
+  typedef typename DAG::NodeIdType NodeId;
+  
+  TRACE_SCOPE ("topologicalSortLexMin");
+  
+  auto inDegree = getInDegree (dag);
+  
+  std::vector <NodeId> L (dag.nNodes());
+  std::size_t nodeCounter = 0;
+  
+  HierarchicalBitset S (dag.nNodes());
+  for (NodeId nodeId = 0; nodeId < dag.nNodes(); nodeId++)
+    if (inDegree[nodeId] == 0)
+      S.insert (nodeId);
+  
+  while (! S.empty()) {
+    const NodeId n = S.popMin();
+    L[nodeCounter++] = n;
+    
+    for (auto targetNodeId : dag[n])
+      if (--inDegree[targetNodeId] == 0)
+        S.insert (targetNodeId);
+  }
+  
+  // if not all nodes could be sorted, there has been a cycle
+  if (nodeCounter != dag.nNodes())
+    throwResidualCycle (dag, inDegree);
+  
+  return L;
+}
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortLexMin (const BasicGraphAdjList <NodeId> & dag) {
+  return topologicalSortLexMinImpl (dag);
+}
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortLexMin (const BasicGraphCSR <NodeId> & dag) {
+  return topologicalSortLexMinImpl (dag);
+}
+
+// Heap of zero-degree nodes, which gives the node with the highest priority first and the
+// smallest id among equal priorities [4-ary heap]
+//
+// The priority is stored besides the node-id, so sifting does not read the priority array.
+// Four children per node halve the height of a binary heap and the children of a node share
+// a cache line.
+template <typename NodeId>
+class PriorityNodeHeap {
+  struct Entry {
+    double priority;
+    NodeId nodeId;
+  };
+  
+  std::vector <Entry> _entries;
+  
+  static inline bool before (const Entry & a, const Entry & b) {
+    return a.priority > b.priority || (a.priority == b.priority && a.nodeId < b.nodeId);
+  }
+  
+public:
+  PriorityNodeHeap (const std::size_t capacity) {
+    _entries.reserve (capacity);
+  }
+  
+  inline bool empty (void) const {
+    return _entries.empty();
+  }
+  
+  void push (const NodeId nodeId, const double priority) {
+    const Entry entry {priority, nodeId};
+    
+    // move the parents down until the place of the new entry is found
+    std::size_t i = _entries.size();
+    _entries.push_back (entry);
+    while (i > 0) {
+      const std::size_t parent = (i - 1) / 4;
+      if (! before (entry, _entries[parent]))
+        break;
+      _entries[i] = _entries[parent];
+      i = parent;
+    }
+    _entries[i] = entry;
+  }
+  
+  NodeId pop (void) {
+    const NodeId top = _entries.front().nodeId;
+    const Entry entry = _entries.back();
+    _entries.pop_back();
+    if (_entries.empty())
+      return top;
+    
+    // move the first child up until the place of the last entry is found
+    const std::size_t n = _entries.size();
+    std::size_t i = 0;
+    while (true) {
+      const std::size_t firstChild = 4 * i + 1;
+      if (firstChild >= n)
+        break;
+      
+      std::size_t child = firstChild;
+      for (std::size_t c = firstChild + 1; c < std::min (firstChild + 4, n); c++)
+        if (before (_entries[c], _entries[child]))
+          child = c;
+      
+      if (! before (_entries[child], entry))
+        break;
+      _entries[i] = _entries[child];
+      i = child;
+    }
+    _entries[i] = entry;
+    
+    return top;
+  }
+};
+
+// Kahn1962 algorithm taking the zero-degree node of the highest priority first, used for every
+// graph type
+template <typename DAG>
+static std::vector <typename DAG::NodeIdType> topologicalSortPriorityImpl (const DAG & dag, const std::vector <double> & priorities) {
+  typedef typename DAG::NodeIdType NodeId;
+  
+  if (priorities.size() != dag.nNodes())
+    throw std::invalid_argument ("The amount of priorities does not fit to the amount of nodes.");
+  
+  TRACE_SCOPE ("topologicalSortPriority");
+  
+  auto inDegree = getInDegree (dag);
+  
+  std::vector <NodeId> L (dag.nNodes());
+  std::size_t nodeCounter = 0;
+  
+  PriorityNodeHeap <NodeId> S (dag.nNodes());
+  for (NodeId nodeId = 0; nodeId < dag.nNodes(); nodeId++)
+    if (inDegree[nodeId] == 0)
+      S.push (nodeId, priorities[nodeId]);
+  
+  while (! S.empty()) {
+    const NodeId n = S.pop();
+    L[nodeCounter++] = n;
+    
+    for (auto targetNodeId : dag[n])
+      if (--inDegree[targetNodeId] == 0)
+        S.push (targetNodeId, priorities[targetNodeId]);
+  }
+  
+  // if not all nodes could be sorted, there has been a cycle
+  if (nodeCounter != dag.nNodes())
+    throwResidualCycle (dag, inDegree);
+  
+  return L;
+}
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortPriority (const BasicGraphAdjList <NodeId> & dag, const std::vector <double> & priorities) {
+  return topologicalSortPriorityImpl (dag, priorities);
+}
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortPriority (const BasicGraphCSR <NodeId> & dag, const std::vector <double> & priorities) {
+  return topologicalSortPriorityImpl (dag, priorities);
+}
+
+// Depth-first search [Corman algorithm] with an explicit stack, used for every graph type,
+// which gives a range of target nodes for 'dag[n]'
+//
+// NOTE: 'nodeColors' and 'stack' are only buffers, so callers sorting many graphs can reuse 
+//       their memory.
+template <typename DAG>
+static std::vector <typename DAG::NodeIdType> topologicalSortCormanIterative (const DAG & dag, std::vector <NodeColor> & nodeColors, std::vector <typename SortScratch <DAG>::Frame> & stack) {
+  typedef typename DAG::NodeIdType NodeId;
+  typedef typename SortScratch <DAG>::Frame Frame;
+  
+  TRACE_SCOPE ("topologicalSortCormanIterative");
+  TRACE_LOCAL_COUNTER (maxDepth);
+  
+  // vector which will contain the sorted vertex-indices
+  std::vector <NodeId> L (dag.nNodes());
+  std::size_t nodeCounter = 0;
+  
+  nodeColors.assign (dag.nNodes(), NodeColor::UNMARKED);
+  stack.clear();
+  
+  // NOTE: The cursor runs once over all nodes (highest id first, like the other Corman 
+  //       implementations), so no set of unmarked nodes is needed.
+  for (std::size_t rootNodeId = dag.nNodes(); rootNodeId-- > 0; ) {
+    if (nodeColors[rootNodeId] != NodeColor::UNMARKED)
+      continue;
+    
+    nodeColors[rootNodeId] = NodeColor::TEMPORARILY_MARKED;
+    stack.push_back (Frame {NodeId (rootNodeId), dag[rootNodeId].begin(), dag[rootNodeId].end()});
+    
+    while (! stack.empty()) {
+      auto & frame = stack.back();
+      
+      // all successors are visited, so the node is finished
+      if (frame.nextEdge == frame.endEdge) {
+        nodeColors[frame.nodeId] = NodeColor::PERMANENTLY_MARKED;
+        L[nodeCounter++] = frame.nodeId;
+        stack.pop_back();
+        continue;
+      }
+      
+      NodeId targetNodeId = *(frame.nextEdge);
+      ++frame.nextEdge;
+      
+      // a back edge closes a cycle, which is given by the nodes on the stack
+      if (nodeColors[targetNodeId] == NodeColor::TEMPORARILY_MARKED)
+        throw BasicGraphCycleException <NodeId> (getCycleFromStack (stack, targetNodeId));
+      
+      if (nodeColors[targetNodeId] == NodeColor::UNMARKED) {
+        nodeColors[targetNodeId] = NodeColor::TEMPORARILY_MARKED;
+        stack.push_back (Frame {targetNodeId, dag[targetNodeId].begin(), dag[targetNodeId].end()});
+        TRACE_UPDATE_MAX (maxDepth, stack.size());
+      }
+    }
+  }
+  TRACE_COUNTER ("topologicalSortCormanIterative:maxDepth", maxDepth);
+  
+  std::reverse (L.begin(), L.end());
+  return L;
+}
+
+template <typename DAG>
+static std::vector <typename DAG::NodeIdType> topologicalSortCormanIterative (const DAG & dag) {
+  std::vector <NodeColor> nodeColors;
+  std::vector <typename SortScratch <DAG>::Frame> stack;
+  return topologicalSortCormanIterative (dag, nodeColors, stack);
+}
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortCormanAdjList3 (const BasicGraphAdjList <NodeId> & posDag) {
+  return topologicalSortCormanIterative (posDag);
+}
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortCormanAdjList3 (const BasicGraphAdjList <NodeId> & posDag, SortScratch <BasicGraphAdjList <NodeId>> & scratch) {
+  return topologicalSortCormanIterative (posDag, scratch.nodeColors, scratch.stack);
+}
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortCormanCSR (const BasicGraphCSR <NodeId> & dag) {
+  return topologicalSortCormanIterative (dag);
+}
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortCormanCSR (const BasicGraphCSR <NodeId> & dag, SortScratch <BasicGraphCSR <NodeId>> & scratch) {
+  return topologicalSortCormanIterative (dag, scratch.nodeColors, scratch.stack);
+}
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortCormanCompressed (const BasicGraphCompressed <NodeId> & dag) {
+  return topologicalSortCormanIterative (dag);
+}
+
+// Queue of zero-degree nodes owned by one thread of 'topologicalSortParallel'
+//
+// The owning thread pushes and pops at the back (LIFO keeps the recently touched nodes in the 
+// cache), other threads steal half of the nodes from the front.
+template <typename NodeId>
+class WorkStealingQueue {
+  std::mutex _mutex;
+  std::vector <NodeId> _nodes;
+  std::size_t _front = 0;
+  
+public:
+  void push (const NodeId nodeId) {
+    std::lock_guard <std::mutex> lock (_mutex);
+    _nodes.push_back (nodeId);
+  }
+  
+  bool pop (NodeId & nodeId) {
+    std::lock_guard <std::mutex> lock (_mutex);
+    if (_front == _nodes.size())
+      return false;
+    
+    nodeId = _nodes.back();
+    _nodes.pop_back();
+    if (_front == _nodes.size()) {
+      _front = 0;
+      _nodes.clear();
+    }
+    return true;
+  }
+  
+  // steal half of the nodes and move them into 'thief'
+  bool steal (WorkStealingQueue & thief) {
+    std::vector <NodeId> stolenNodes;
+    {
+      std::unique_lock <std::mutex> lock (_mutex, std::try_to_lock);
+      if (! lock.owns_lock() || _front == _nodes.size())
+        return false;
+      
+      auto nStolenNodes = (_nodes.size() - _front + 1) / 2;
+      stolenNodes.assign (_nodes.begin() + _front, _nodes.begin() + _front + nStolenNodes);
+      _front += nStolenNodes;
+      if (_front == _nodes.size()) {
+        _front = 0;
+        _nodes.clear();
+      }
+    }
+    
+    std::lock_guard <std::mutex> lock (thief._mutex);
+    thief._nodes.insert (thief._nodes.end(), stolenNodes.begin(), stolenNodes.end());
+    return true;
+  }
+};
+
+template <typename DAG>
+static std::vector <typename DAG::NodeIdType> topologicalSortParallelImpl (const DAG & dag, unsigned int nThreads) {
+  typedef typename DAG::NodeIdType NodeId;
+  
+  TRACE_SCOPE ("topologicalSortParallel");
+  
+  const std::size_t nNodes = dag.nNodes();
+  nThreads = getNumberOfThreads (nThreads, nNodes, 4096);
+  
+  // NOTE: std::atomic is not initialized by its default constructor
+  TRACE_PHASE_BEGIN (inDegree, "topologicalSortParallel:getInDegree");
+  std::vector <std::atomic <std::size_t>> inDegree (nNodes);
+  runInParallel (nThreads, [&](unsigned int threadId) {
+    auto range = getThreadRange (nNodes, threadId, nThreads);
+    for (auto nodeId = range.first; nodeId < range.second; nodeId++)
+      inDegree[nodeId].store (0, std::memory_order_relaxed);
+  });
+  runInParallel (nThreads, [&](unsigned int threadId) {
+    auto range = getThreadRange (nNodes, threadId, nThreads);
+    for (auto sourceNodeId = range.first; sourceNodeId < range.second; sourceNodeId++)
+      for (auto targetNodeId : dag[sourceNodeId])
+        inDegree[targetNodeId].fetch_add (1, std::memory_order_relaxed);
+  });
+  TRACE_PHASE_END (inDegree);
+  
+  // list which will contain the sorted vertex-indices
+  std::vector <NodeId> L (nNodes);
+  std::atomic <std::size_t> nodeCounter (0);
+  
+  // amount of zero-degree nodes, which are queued or processed right now
+  std::atomic <std::size_t> nPendingNodes (0);
+  std::vector <WorkStealingQueue <NodeId>> queues (nThreads);
+  
+  TRACE_PHASE_BEGIN (seed, "topologicalSortParallel:seed");
+  runInParallel (nThreads, [&](unsigned int threadId) {
+    auto & queue = queues[threadId];
+    
+    // every thread collects the zero-degree nodes of its part of the graph ...
+    auto range = getThreadRange (nNodes, threadId, nThreads);
+    std::size_t nZeroDegreeNodes = 0;
+    for (auto nodeId = range.first; nodeId < range.second; nodeId++)
+      if (inDegree[nodeId].load (std::memory_order_relaxed) == 0) {
+        queue.push (nodeId);
+        nZeroDegreeNodes++;
+      }
+    nPendingNodes.fetch_add (nZeroDegreeNodes);
+  });
+  TRACE_PHASE_END (seed);
+  
+  runInParallel (nThreads, [&](unsigned int threadId) {
+    TRACE_SCOPE ("topologicalSortParallel:drain");
+    TRACE_LOCAL_COUNTER (nRelaxedEdges);
+    auto & queue = queues[threadId];
+    
+    // ... and processes them, until no thread has nodes left
+    while (true) {
+      NodeId n;
+      bool hasNode = queue.pop (n);
+      for (unsigned int i = 1; ! hasNode && i < nThreads; i++)
+        if (queues[(threadId + i) % nThreads].steal (queue))
+          hasNode = queue.pop (n);
+      
+      if (! hasNode) {
+        // NOTE: New zero-degree nodes are only found while processing a pending node, so
+        //       if there are no pending nodes, the sorting is done.
+        if (nPendingNodes.load() == 0)
+          break;
+        std::this_thread::yield();
+        continue;
+      }
+      
+      L[nodeCounter.fetch_add (1, std::memory_order_relaxed)] = n;
+      
+      // delete n as precondition (incoming edge) from all its successors
+      for (auto targetNodeId : dag[n]) {
+        TRACE_INCREMENT (nRelaxedEdges);
+        if (inDegree[targetNodeId].fetch_sub (1, std::memory_order_acq_rel) == 1) {
+          nPendingNodes.fetch_add (1);
+          queue.push (targetNodeId);
+        }
+      }
+      
+      nPendingNodes.fetch_sub (1);
+    }
+    TRACE_COUNTER ("topologicalSortParallel:relaxedEdges", nRelaxedEdges);
+  });
+  
+  // if not all nodes could be sorted, there has been a cycle
+  if (nodeCounter.load() != nNodes)
+    throwResidualCycle (dag, inDegree);
+  
+  return L;
+}
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortParallel (const BasicGraphAdjList <NodeId> & dag, unsigned int nThreads) {
+  return topologicalSortParallelImpl (dag, nThreads);
+}
+
+template <typename NodeId>
+std::vector <NodeId> topologicalSortParallel (const BasicGraphCSR <NodeId> & dag, unsigned int nThreads) {
+  return topologicalSortParallelImpl (dag, nThreads);
+}
+
+template <typename NodeId>
+std::vector <NodeId> findCycle (const BasicGraphAdjList <NodeId> & graph) {
+  return findCycleImpl (graph, [](NodeId) { return true; });
+}
+
+template <typename NodeId>
+std::vector <NodeId> findCycle (const BasicGraphCSR <NodeId> & graph) {
+  return findCycleImpl (graph, [](NodeId) { return true; });
+}
+
+template <typename NodeId>
+std::vector <NodeId> findCycle (const BasicGraphCompressed <NodeId> & graph) {
+  return findCycleImpl (graph, [](NodeId) { return true; });
+}
+
 // HELPER FUNCTION FOR THE SORTING ALGORITHMS
 bool hasIncommingEdges (const Graph & dag, unsigned int vertexInd) {
   for (unsigned int sourceVertexId = 0; sourceVertexId < dag.rows(); sourceVertexId++) 
@@ -248,14 +1041,34 @@ bool hasDAGEdges (const Graph & dag) {
     return false;
 }
 
-std::vector <unsigned int> getInDegree (const GraphAdjList & dag) {
-  std::vector <unsigned int> inDegree (dag.nNodes(), 0);
+template <typename NodeId>
+std::vector <std::size_t> getInDegree (const BasicGraphAdjList <NodeId> & dag) {
+  std::vector <std::size_t> inDegree;
+  getInDegreeInto (dag, inDegree);
+  return inDegree;
+}
+
+std::vector <unsigned int> getInDegree (const BitMatrix & dag) {
+  std::vector <unsigned int> inDegree (dag.nNodes());
   
-  for (size_t sourceNodeId = 0; sourceNodeId < dag.nNodes(); sourceNodeId++)
-    for (auto targetNodeId : dag[sourceNodeId])
-      inDegree[targetNodeId]++;
-    
-    return inDegree;
+  for (unsigned int nodeId = 0; nodeId < dag.nNodes(); nodeId++)
+    inDegree[nodeId] = dag.inDegree (nodeId);
+  
+  return inDegree;
+}
+
+template <typename NodeId>
+std::vector <std::size_t> getInDegree (const BasicGraphCSR <NodeId> & dag) {
+  std::vector <std::size_t> inDegree;
+  getInDegreeInto (dag, inDegree);
+  return inDegree;
+}
+
+template <typename NodeId>
+std::vector <std::size_t> getInDegree (const BasicGraphCompressed <NodeId> & dag) {
+  std::vector <std::size_t> inDegree;
+  getInDegreeInto (dag, inDegree);
+  return inDegree;
 }
 
 void visit (const unsigned int sourceNodeId, GraphAdjList & posDag, std::vector <unsigned int> & L, std::set <unsigned int> & unmarkedNodes) {
@@ -313,63 +1126,209 @@ bool checkTopologicalSorting (const std::vector <unsigned int> & topologicalSort
   return true;
 }
 
-bool checkTopologicalSorting (const std::vector <unsigned int> & topologicalSorting, const GraphAdjList & dag) {
+// Check of a sorting using the position of every node, used for every graph type
+template <typename DAG>
+static bool checkTopologicalSortingImpl (const std::vector <typename DAG::NodeIdType> & topologicalSorting, const DAG & dag, unsigned int nThreads) {
+  typedef typename DAG::NodeIdType NodeId;
+  
   // check whether the sorting contain enough nodes
   if (dag.nNodes() != topologicalSorting.size())
-    throw std::invalid_argument ("The topological sorting and the adjacency list does not fit considering there dimension");
-  
-  auto negDag = mapFromPosIndecencyToNegIndecency (dag);
+    throw std::invalid_argument ("The topological sorting and the graph does not fit considering there dimension");
   
-  for (auto node = topologicalSorting.begin(); node != topologicalSorting.end(); ++node) {
-    // If a node has incoming edged, than there are preconditions (other nodes), which has not been done (deleted) till now.
-    if (! negDag[*node].empty())
+  // position of every node within the sorting, every node has to occur exactly ones
+  // NOTE: 'nNodes' fits into 'NodeId', because the largest node-id is at most nNodes - 1.
+  const std::size_t nNodes = dag.nNodes();
+  std::vector <NodeId> position (nNodes, nNodes);
+  for (std::size_t i = 0; i < nNodes; i++) {
+    auto nodeId = topologicalSorting[i];
+    if (nodeId >= nNodes || position[nodeId] != nNodes)
       return false;
-    
-    // Delete the current node to indicate, that it is now precondition anymore. To do this, all incoming edges outgoing from the current node has to be deleted.
-    for (unsigned int preconditionNodeId = 0; preconditionNodeId < negDag.nNodes(); preconditionNodeId++) {
-      negDag.deleteEdge (Edge (preconditionNodeId, *node));
-    }
+    position[nodeId] = i;
   }
   
-  return true;
+  // every edge has to point from an earlier to a later node
+  // NOTE: The edges of a node are checked without branching, so the compiler can vectorize
+  //       the loop. The threads stop early, if one of them found an invalid edge.
+  nThreads = getNumberOfThreads (nThreads, nNodes, 1 << 16);
+  std::atomic <bool> isValid (true);
+  
+  runInParallel (nThreads, [&](unsigned int threadId) {
+    auto range = getThreadRange (nNodes, threadId, nThreads);
+    for (auto sourceNodeId = range.first; sourceNodeId < range.second && isValid.load (std::memory_order_relaxed); sourceNodeId++) {
+      const auto sourcePosition = position[sourceNodeId];
+      
+      bool isValidNode = true;
+      for (auto targetNodeId : dag[sourceNodeId])
+        isValidNode &= position[targetNodeId] > sourcePosition;
+      
+      if (! isValidNode)
+        isValid.store (false, std::memory_order_relaxed);
+    }
+  });
+  
+  return isValid.load();
+}
+
+template <typename NodeId>
+bool checkTopologicalSorting (const std::vector <NodeId> & topologicalSorting, const BasicGraphAdjList <NodeId> & dag, unsigned int nThreads) {
+  return checkTopologicalSortingImpl (topologicalSorting, dag, nThreads);
+}
+
+template <typename NodeId>
+bool checkTopologicalSorting (const std::vector <NodeId> & topologicalSorting, const BasicGraphCSR <NodeId> & dag, unsigned int nThreads) {
+  return checkTopologicalSortingImpl (topologicalSorting, dag, nThreads);
+}
+
+template <typename NodeId>
+bool checkTopologicalSorting (const std::vector <NodeId> & topologicalSorting, const BasicGraphCompressed <NodeId> & dag, unsigned int nThreads) {
+  return checkTopologicalSortingImpl (topologicalSorting, dag, nThreads);
 }
 
 // FUNCTIONS TO READ GRAPHS FROM FILES AND CREATE REPRESENTATIONS TO PROCESS THEM
 std::vector <Edge> readEdgesFromFile (const std::string & filename) {
-  std::ifstream inFile (filename);
-  if (! inFile) 
-    throw std::invalid_argument ("Cannot open file: " + filename);
+  ReadStatistics statistics;
+  return readEdgesFromMappedFile (filename, statistics);
+}
 
-  std::vector <Edge> edges; 
+void readEdgesFromFile (const std::string & filename, std::vector <Edge> & posEdges, std::vector <Edge> & negEdges) {
+  auto edges = readEdgesFromFile (filename);
+  
+  posEdges.reserve (posEdges.size() + edges.size());
+  negEdges.reserve (negEdges.size() + edges.size());
+  for (auto & edge : edges) {
+    posEdges.push_back (edge);
+    negEdges.push_back (Edge (edge.second, edge.first));
+  }
+}
+
+std::vector <Edge> readEdgesFromMappedFile (const std::string & filename, ReadStatistics & statistics) {
+  TRACE_SCOPE ("readEdgesFromMappedFile");
+  auto startTime = std::chrono::steady_clock::now();
+  
+  TRACE_PHASE_BEGIN (map, "readEdgesFromMappedFile:map");
+  MappedFile file (filename);
+  TRACE_PHASE_END (map);
+  
+  TRACE_PHASE_BEGIN (count, "readEdgesFromMappedFile:countLines");
+  const std::size_t nLines = countLines (file.begin(), file.end());
+  TRACE_PHASE_END (count);
+  
+  TRACE_PHASE_BEGIN (parse, "readEdgesFromMappedFile:parse");
+  std::vector <Edge> edges;
+  edges.reserve (nLines);
+  parseEdges (file.begin(), file.end(), edges);
+  TRACE_PHASE_END (parse);
+  TRACE_COUNTER ("readEdgesFromMappedFile:bytes", file.size());
+  
+  statistics.nBytes = file.size();
+  statistics.duration = std::chrono::duration_cast <timeDuration> (std::chrono::steady_clock::now() - startTime);
+  
+  return edges;
+}
+
+// Function to parse a single node-id, returns false if no valid node-id is at 'it'
+static inline bool parseNodeId (const char * & it, const char * end, unsigned int & nodeId) {
+  skipWhitespace (it, end);
+  return parseNumber (it, end, nodeId);
+}
+
+const char * parseEdges (const char * bgn, const char * end, std::vector <Edge> & edges) {
   unsigned int sourceNodeId, targetNodeId;
-  // NOTE: >> uses WHITESPACE and NEWLINE as delimiters 
-  while (inFile >> sourceNodeId >> targetNodeId) {
-    edges.push_back (Edge (sourceNodeId, targetNodeId));
+  
+  const char * it = bgn;
+  while (true) {
+    skipWhitespace (it, end);
+    const char * edgeBgn = it;
+    if (! parseNodeId (it, end, sourceNodeId) || ! parseNodeId (it, end, targetNodeId))
+      return edgeBgn;
     
-//     std::cout << "add edge to graph:" << std::endl
-//               << "(" << edges.back().first << ")"
-//               << " --> "
-//               << "(" << edges.back().second << ")"
-//               << std::endl;
+    edges.push_back (Edge (sourceNodeId, targetNodeId));
   }
-    
-  inFile.close();
+}
+
+// Function to parse the node-ids of [bgn, end) and append them to 'nodeIds', returns the 
+// position where parsing stopped, which is 'end' if all tokens were valid node-ids
+static const char * parseNodeIds (const char * bgn, const char * end, std::vector <unsigned int> & nodeIds) {
+  unsigned int nodeId;
   
-  return edges;
+  const char * it = bgn;
+  while (true) {
+    skipWhitespace (it, end);
+    if (it == end || ! parseNodeId (it, end, nodeId))
+      return it;
+    
+    nodeIds.push_back (nodeId);
+  }
 }
 
-void readEdgesFromFile (const std::string & filename, std::vector <Edge> & posEdges, std::vector <Edge> & negEdges) {
-  std::ifstream inFile (filename);
-  if (! inFile) 
-    throw std::invalid_argument ("Cannot open file: " + filename);
+std::vector <Edge> readEdgesFromFileParallel (const std::string & filename, unsigned int nThreads) {
+  TRACE_SCOPE ("readEdgesFromFileParallel");
   
-  unsigned int sourceNodeId, targetNodeId;
-  while (inFile >> sourceNodeId >> targetNodeId) {
-    posEdges.push_back (Edge (sourceNodeId, targetNodeId));
-    negEdges.push_back (Edge (targetNodeId, sourceNodeId));
+  MappedFile file (filename);
+  
+  // NOTE: Small files are parsed faster than the threads are started.
+  const std::size_t minBytesPerThread = 1 << 20;
+  nThreads = getNumberOfThreads (nThreads, file.size(), minBytesPerThread);
+  
+  // every chunk but the first one starts behind a NEWLINE, so no node-id is split
+  std::vector <const char *> chunkBgn (nThreads + 1, file.end());
+  chunkBgn[0] = file.begin();
+  for (unsigned int threadId = 1; threadId < nThreads; threadId++) {
+    auto it = std::max (chunkBgn[threadId - 1], file.begin() + file.size() * threadId / nThreads);
+    auto newline = static_cast <const char *> (std::memchr (it, '\n', file.end() - it));
+    chunkBgn[threadId] = newline ? newline + 1 : file.end();
   }
   
-  inFile.close();
+  // NOTE: An edge may span a NEWLINE, so the chunks keep single node-ids, which are paired 
+  //       by their position within the whole file afterwards.
+  TRACE_PHASE_BEGIN (parse, "readEdgesFromFileParallel:parse");
+  std::vector <std::vector <unsigned int>> nodeIds (nThreads);
+  std::vector <char> isComplete (nThreads);
+  runInParallel (nThreads, [&](unsigned int threadId) {
+    const char * bgn = chunkBgn[threadId];
+    const char * end = chunkBgn[threadId + 1];
+    
+    nodeIds[threadId].reserve (2 * countLines (bgn, end));
+    
+    isComplete[threadId] = parseNodeIds (bgn, end, nodeIds[threadId]) == end;
+  });
+  TRACE_PHASE_END (parse);
+  
+  // like 'parseEdges' the parsing stops at the first invalid token, so the chunks behind it 
+  // are not used
+  std::vector <std::size_t> nodeIdOffsets (nThreads + 1, 0);
+  unsigned int nUsedChunks = 0;
+  while (nUsedChunks < nThreads) {
+    nodeIdOffsets[nUsedChunks + 1] = nodeIdOffsets[nUsedChunks] + nodeIds[nUsedChunks].size();
+    if (! isComplete[nUsedChunks++])
+      break;
+  }
+  
+  // a last source node without target node is ignored
+  const std::size_t nEdges = nodeIdOffsets[nUsedChunks] / 2;
+  
+  TRACE_PHASE_BEGIN (merge, "readEdgesFromFileParallel:merge");
+  std::vector <Edge> edges (nEdges);
+  runInParallel (nUsedChunks, [&](unsigned int threadId) {
+    std::size_t position = nodeIdOffsets[threadId];
+    for (auto nodeId : nodeIds[threadId]) {
+      if (position == 2 * nEdges)
+        break;
+      
+      if (position % 2 == 0)
+        edges[position / 2].first = nodeId;
+      else
+        edges[position / 2].second = nodeId;
+      position++;
+    }
+    
+    // the node-ids of this chunk are not needed anymore
+    std::vector <unsigned int> ().swap (nodeIds[threadId]);
+  });
+  TRACE_PHASE_END (merge);
+  TRACE_COUNTER ("readEdgesFromFileParallel:bytes", file.size());
+  
+  return edges;
 }
 
 Graph createGraphFromEdges (const std::vector <Edge> & edges) {
@@ -389,23 +1348,286 @@ Graph createGraphFromEdges (const std::vector <Edge> & edges) {
   return graph;
 }
 
-GraphAdjList createGraphAdjListFromEdges (const std::vector <Edge> & edges) {
+// Function to give the amount of nodes of a graph with the given edges, which has to fit
+// into the node-id type
+template <typename NodeId>
+static std::size_t getNumberOfNodes (const std::vector <BasicEdge <NodeId>> & edges) {
+  auto maxNodeId = getMaxNodeId (edges);
+  if (maxNodeId == std::numeric_limits <NodeId>::max())
+    throw std::invalid_argument ("The amount of nodes does not fit into the node-id type.");
+  
+  // NOTE: a node can have id 0
+  return std::size_t (maxNodeId) + 1;
+}
+
+template <typename NodeId>
+BasicGraphAdjList <NodeId> createGraphAdjListFromEdges (const std::vector <BasicEdge <NodeId>> & edges) {
+  TRACE_SCOPE ("createGraphAdjListFromEdges");
+  
   if (edges.size() < 1)
-    return GraphAdjList();
+    return BasicGraphAdjList <NodeId> ();
   
-  auto maxNodeId = getMaxNodeId (edges);
+  TRACE_PHASE_BEGIN (maxNodeId, "createGraphAdjListFromEdges:getMaxNodeId");
+  auto nNodes = getNumberOfNodes (edges);
+  TRACE_PHASE_END (maxNodeId);
   
   // initialize a empty graph
-  // NOTE: a node can have id 0
-  GraphAdjList graph (maxNodeId + 1);
+  TRACE_PHASE_BEGIN (insert, "createGraphAdjListFromEdges:insertEdges");
+  BasicGraphAdjList <NodeId> graph (nNodes);
+  graph.pool() -> reserve (edges.size());
   
-  std::for_each (edges.begin(), edges.end(), [&graph](Edge e) {
+  std::for_each (edges.begin(), edges.end(), [&graph](BasicEdge <NodeId> e) {
     graph.insertEdge (e, false);
   });
+  TRACE_PHASE_END (insert);
+  
+  return graph;
+}
+
+BitMatrix createBitMatrixFromEdges (const std::vector <Edge> & edges) {
+  if (edges.size() < 1)
+    return BitMatrix();
+  
+  // NOTE: a node can have id 0
+  BitMatrix graph (getMaxNodeId (edges) + 1);
+  
+  for (auto & edge : edges)
+    graph.set (edge.first, edge.second);
   
   return graph;
 }
 
+BitMatrix createBitMatrixFromGraph (const Graph & graph) {
+  if (graph.cols() != graph.rows())
+    throw std::invalid_argument ("Adjacency matrix is not quadratic and therefor not valid.");
+  
+  BitMatrix bitMatrix (graph.rows());
+  
+  for (unsigned int i = 0; i < graph.rows(); i++) for (unsigned int j = 0; j < graph.cols(); j++)
+    if (graph(i, j) != 0)
+      bitMatrix.set (i, j);
+  
+  return bitMatrix;
+}
+
+template <typename NodeId>
+BasicGraphCSR <NodeId> createGraphCSRFromEdges (const std::vector <BasicEdge <NodeId>> & edges) {
+  TRACE_SCOPE ("createGraphCSRFromEdges");
+  
+  if (edges.size() < 1)
+    return BasicGraphCSR <NodeId> ();
+  
+  auto nNodes = getNumberOfNodes (edges);
+  
+  // count the outgoing edges of every node, shifted by one ...
+  TRACE_PHASE_BEGIN (count, "createGraphCSRFromEdges:count");
+  std::vector <std::size_t> offsets (nNodes + 1, 0);
+  for (auto & edge : edges)
+    offsets[edge.first + 1]++;
+  
+  // ... so that the prefix sum gives the position of the first edge of each node
+  std::partial_sum (offsets.begin(), offsets.end(), offsets.begin());
+  TRACE_PHASE_END (count);
+  
+  TRACE_PHASE_BEGIN (scatter, "createGraphCSRFromEdges:scatter");
+  std::vector <NodeId> targets (edges.size());
+  std::vector <std::size_t> insertPosition (offsets.begin(), offsets.end() - 1);
+  for (auto & edge : edges)
+    targets[insertPosition[edge.first]++] = edge.second;
+  TRACE_PHASE_END (scatter);
+  
+  return BasicGraphCSR <NodeId> (std::move (offsets), std::move (targets));
+}
+
+// Stable counting sort of the edges by their source node (or by their target node, if 
+// 'byTarget') on several threads, gives the offsets and the other nodes of the edges in the
+// compressed sparse row format
+//
+// The nodes are split into buckets of 2^bucketShift consecutive nodes, 4 to 8 per thread. 
+// Every thread counts the edges of its part of the edge vector per bucket and moves them into
+// 'buffer', ordered by the buckets and within a bucket by the threads. Afterwards every thread
+// sorts whole buckets by their nodes using a histogram over the nodes of a single bucket. Both
+// steps keep the order of the edges, so the edges of a node keep their order like in 
+// 'createGraphCSRFromEdges'.
+template <bool byTarget, typename NodeId>
+static void sortEdgesByNodeParallel (const std::vector <BasicEdge <NodeId>> & edges, const std::size_t nNodes, const unsigned int nThreads, std::vector <BasicEdge <NodeId>> & buffer, std::vector <std::size_t> & offsets, std::vector <NodeId> & targets) {
+  auto getNode = [](const BasicEdge <NodeId> & edge) { return byTarget ? edge.second : edge.first; };
+  auto getOtherNode = [](const BasicEdge <NodeId> & edge) { return byTarget ? edge.first : edge.second; };
+  
+  // NOTE: The bucket of a node is given by a shift instead of a division.
+  unsigned int bucketShift = 0;
+  while ((nNodes >> bucketShift) > 8 * std::size_t (nThreads))
+    bucketShift++;
+  const std::size_t nBuckets = ((nNodes - 1) >> bucketShift) + 1;
+  
+  // counts[threadId * nBuckets + bucket] is the amount of edges of the thread within the 
+  // bucket, later the position of its next edge within 'buffer'
+  TRACE_PHASE_BEGIN (bucket, "createGraphCSRFromEdgesParallel:bucket");
+  std::vector <std::size_t> counts (nThreads * nBuckets, 0);
+  runInParallel (nThreads, [&](unsigned int threadId) {
+    auto range = getThreadRange (edges.size(), threadId, nThreads);
+    auto count = counts.data() + threadId * nBuckets;
+    for (auto i = range.first; i < range.second; i++)
+      count[getNode (edges[i]) >> bucketShift]++;
+  });
+  
+  std::vector <std::size_t> bucketBgn (nBuckets + 1);
+  std::size_t position = 0;
+  for (std::size_t bucket = 0; bucket < nBuckets; bucket++) {
+    bucketBgn[bucket] = position;
+    for (unsigned int t = 0; t < nThreads; t++) {
+      auto nEdges = counts[t * nBuckets + bucket];
+      counts[t * nBuckets + bucket] = position;
+      position += nEdges;
+    }
+  }
+  bucketBgn[nBuckets] = position;
+  
+  runInParallel (nThreads, [&](unsigned int threadId) {
+    auto range = getThreadRange (edges.size(), threadId, nThreads);
+    auto position = counts.data() + threadId * nBuckets;
+    for (auto i = range.first; i < range.second; i++)
+      buffer[position[getNode (edges[i]) >> bucketShift]++] = edges[i];
+  });
+  TRACE_PHASE_END (bucket);
+  
+  // every thread sorts the buckets starting within its part of the edges, so the threads get
+  // about the same amount of edges, even if the degrees are skewed
+  TRACE_PHASE_BEGIN (sort, "createGraphCSRFromEdgesParallel:sort");
+  offsets.assign (nNodes + 1, 0);
+  targets.resize (edges.size());
+  runInParallel (nThreads, [&](unsigned int threadId) {
+    auto range = getThreadRange (edges.size(), threadId, nThreads);
+    if (threadId + 1 == nThreads)
+      range.second++;
+    
+    // position of the next edge of every node of the bucket
+    std::vector <std::size_t> position;
+    for (std::size_t bucket = 0; bucket < nBuckets; bucket++) {
+      if (bucketBgn[bucket] < range.first || bucketBgn[bucket] >= range.second)
+        continue;
+      
+      const std::size_t nodeBgn = bucket << bucketShift;
+      const std::size_t nodeEnd = std::min (nNodes, (bucket + 1) << bucketShift);
+      position.assign (nodeEnd - nodeBgn, 0);
+      for (auto i = bucketBgn[bucket]; i < bucketBgn[bucket + 1]; i++)
+        position[getNode (buffer[i]) - nodeBgn]++;
+      
+      std::size_t sum = bucketBgn[bucket];
+      for (auto nodeId = nodeBgn; nodeId < nodeEnd; nodeId++) {
+        auto nEdges = position[nodeId - nodeBgn];
+        position[nodeId - nodeBgn] = sum;
+        sum += nEdges;
+        offsets[nodeId + 1] = sum;
+      }
+      
+      for (auto i = bucketBgn[bucket]; i < bucketBgn[bucket + 1]; i++)
+        targets[position[getNode (buffer[i]) - nodeBgn]++] = getOtherNode (buffer[i]);
+    }
+  });
+  TRACE_PHASE_END (sort);
+}
+
+// Counting sort of the edges by their source node (and by their target node for 'negDag') on
+// several threads, used by both 'createGraphCSRFromEdgesParallel'
+template <typename NodeId>
+static void createGraphCSRFromEdgesParallelImpl (const std::vector <BasicEdge <NodeId>> & edges, BasicGraphCSR <NodeId> & posDag, BasicGraphCSR <NodeId> * negDag, unsigned int nThreads) {
+  TRACE_SCOPE ("createGraphCSRFromEdgesParallel");
+  
+  if (edges.size() < 1) {
+    posDag = BasicGraphCSR <NodeId> ();
+    if (negDag)
+      *negDag = BasicGraphCSR <NodeId> ();
+    return;
+  }
+  
+  const std::size_t minEdgesPerThread = 1 << 16;
+  nThreads = getNumberOfThreads (nThreads, edges.size(), minEdgesPerThread);
+  
+  // a single thread does not need the buckets
+  if (nThreads == 1 && ! negDag) {
+    posDag = createGraphCSRFromEdges (edges);
+    return;
+  }
+  
+  TRACE_PHASE_BEGIN (nodes, "createGraphCSRFromEdgesParallel:getNumberOfNodes");
+  std::vector <NodeId> maxNodeIds (nThreads, 0);
+  runInParallel (nThreads, [&](unsigned int threadId) {
+    auto range = getThreadRange (edges.size(), threadId, nThreads);
+    NodeId maxNodeId = 0;
+    for (auto i = range.first; i < range.second; i++)
+      maxNodeId = std::max (maxNodeId, std::max (edges[i].first, edges[i].second));
+    maxNodeIds[threadId] = maxNodeId;
+  });
+  
+  auto maxNodeId = *std::max_element (maxNodeIds.begin(), maxNodeIds.end());
+  if (maxNodeId == std::numeric_limits <NodeId>::max())
+    throw std::invalid_argument ("The amount of nodes does not fit into the node-id type.");
+  const std::size_t nNodes = std::size_t (maxNodeId) + 1;
+  TRACE_PHASE_END (nodes);
+  
+  // NOTE: The buffer is shared by both directions.
+  std::vector <BasicEdge <NodeId>> buffer (edges.size());
+  std::vector <std::size_t> posOffsets, negOffsets;
+  std::vector <NodeId> posTargets, negTargets;
+  
+  sortEdgesByNodeParallel <false> (edges, nNodes, nThreads, buffer, posOffsets, posTargets);
+  if (negDag)
+    sortEdgesByNodeParallel <true> (edges, nNodes, nThreads, buffer, negOffsets, negTargets);
+  
+  posDag = BasicGraphCSR <NodeId> (std::move (posOffsets), std::move (posTargets));
+  if (negDag)
+    *negDag = BasicGraphCSR <NodeId> (std::move (negOffsets), std::move (negTargets));
+}
+
+template <typename NodeId>
+BasicGraphCSR <NodeId> createGraphCSRFromEdgesParallel (const std::vector <BasicEdge <NodeId>> & edges, unsigned int nThreads) {
+  BasicGraphCSR <NodeId> posDag;
+  createGraphCSRFromEdgesParallelImpl (edges, posDag, (BasicGraphCSR <NodeId> *) nullptr, nThreads);
+  return posDag;
+}
+
+template <typename NodeId>
+void createGraphCSRFromEdgesParallel (const std::vector <BasicEdge <NodeId>> & edges, BasicGraphCSR <NodeId> & posDag, BasicGraphCSR <NodeId> & negDag, unsigned int nThreads) {
+  createGraphCSRFromEdgesParallelImpl (edges, posDag, &negDag, nThreads);
+}
+
+template <typename NodeId>
+BasicGraphCompressed <NodeId> createGraphCompressedFromEdges (const std::vector <BasicEdge <NodeId>> & edges) {
+  return createGraphCompressedFromCSR (createGraphCSRFromEdges (edges));
+}
+
+template <typename NodeId>
+BasicGraphCompressed <NodeId> createGraphCompressedFromCSR (const BasicGraphCSR <NodeId> & graph) {
+  typedef BasicGraphCompressed <NodeId> GraphType;
+  
+  TRACE_SCOPE ("createGraphCompressedFromCSR");
+  
+  std::vector <std::size_t> offsets (graph.nNodes() + 1, 0);
+  std::vector <uint8_t> bytes;
+  // NOTE: Most differences of local ids fit into one or two bytes.
+  bytes.reserve (graph.nEdges() * 2);
+  
+  // the targets of one node, which are sorted before encoding them
+  std::vector <NodeId> targets;
+  for (std::size_t sourceNodeId = 0; sourceNodeId < graph.nNodes(); sourceNodeId++) {
+    auto adjacentNodes = graph[sourceNodeId];
+    targets.assign (adjacentNodes.begin(), adjacentNodes.end());
+    std::sort (targets.begin(), targets.end());
+    
+    for (std::size_t i = 0; i < targets.size(); i++) {
+      if (i == 0)
+        GraphType::encodeVarint (GraphType::encodeFirstTarget (NodeId (sourceNodeId), targets[0]), bytes);
+      else
+        GraphType::encodeVarint (uint64_t (targets[i] - targets[i - 1]), bytes);
+    }
+    
+    offsets[sourceNodeId + 1] = bytes.size();
+  }
+  
+  return GraphType (offsets, std::move (bytes), graph.nEdges());
+}
+
 GraphAdjList mapFromPosIndecencyToNegIndecency (const GraphAdjList & posIndecencyGraph) {
   if (posIndecencyGraph.isEmpty())
     return GraphAdjList();
@@ -425,13 +1647,56 @@ GraphAdjList mapFromPosIndecencyToNegIndecency (const GraphAdjList & posIndecenc
   return negIndecencyGraph;
 }
 
-unsigned int getMaxNodeId (const std::vector <Edge> edges) {
-  unsigned int maxNodeId = 0;
+template <typename NodeId>
+NodeId getMaxNodeId (const std::vector <BasicEdge <NodeId>> & edges) {
+  NodeId maxNodeId = 0;
   for (auto & edge : edges)
     maxNodeId = std::max (maxNodeId, std::max (edge.first, edge.second));
   return maxNodeId;
 }
 
+// EXPLICIT INSTANTIATIONS FOR THE NODE-ID TYPES
+#define INSTANTIATE_NODE_ID_FUNCTIONS(NodeId) \
+  template class BasicGraphCycleException <NodeId>; \
+  template std::vector <NodeId> topologicalSortAdjList4 (const BasicGraphAdjList <NodeId> &); \
+  template std::vector <NodeId> topologicalSortCormanAdjList3 (const BasicGraphAdjList <NodeId> &); \
+  template std::vector <NodeId> topologicalSortCSR (const BasicGraphCSR <NodeId> &); \
+  template std::vector <NodeId> topologicalSortCormanCSR (const BasicGraphCSR <NodeId> &); \
+  template std::vector <NodeId> topologicalSortAdjList4 (const BasicGraphAdjList <NodeId> &, SortScratch <BasicGraphAdjList <NodeId>> &); \
+  template std::vector <NodeId> topologicalSortCormanAdjList3 (const BasicGraphAdjList <NodeId> &, SortScratch <BasicGraphAdjList <NodeId>> &); \
+  template std::vector <NodeId> topologicalSortCSR (const BasicGraphCSR <NodeId> &, SortScratch <BasicGraphCSR <NodeId>> &); \
+  template std::vector <NodeId> topologicalSortCormanCSR (const BasicGraphCSR <NodeId> &, SortScratch <BasicGraphCSR <NodeId>> &); \
+  template std::vector <NodeId> topologicalSortCompressed (const BasicGraphCompressed <NodeId> &); \
+  template std::vector <NodeId> topologicalSortCormanCompressed (const BasicGraphCompressed <NodeId> &); \
+  template std::vector <NodeId> topologicalSortLexMin (const BasicGraphAdjList <NodeId> &); \
+  template std::vector <NodeId> topologicalSortLexMin (const BasicGraphCSR <NodeId> &); \
+  template std::vector <NodeId> topologicalSortPriority (const BasicGraphAdjList <NodeId> &, const std::vector <double> &); \
+  template std::vector <NodeId> topologicalSortPriority (const BasicGraphCSR <NodeId> &, const std::vector <double> &); \
+  template BasicTopologicalLevels <NodeId> topologicalSortLevels (const BasicGraphAdjList <NodeId> &); \
+  template BasicTopologicalLevels <NodeId> topologicalSortLevels (const BasicGraphCSR <NodeId> &); \
+  template std::vector <NodeId> topologicalSortParallel (const BasicGraphAdjList <NodeId> &, unsigned int); \
+  template std::vector <NodeId> topologicalSortParallel (const BasicGraphCSR <NodeId> &, unsigned int); \
+  template std::vector <NodeId> findCycle (const BasicGraphAdjList <NodeId> &); \
+  template std::vector <NodeId> findCycle (const BasicGraphCSR <NodeId> &); \
+  template std::vector <NodeId> findCycle (const BasicGraphCompressed <NodeId> &); \
+  template std::vector <std::size_t> getInDegree (const BasicGraphAdjList <NodeId> &); \
+  template std::vector <std::size_t> getInDegree (const BasicGraphCSR <NodeId> &); \
+  template std::vector <std::size_t> getInDegree (const BasicGraphCompressed <NodeId> &); \
+  template bool checkTopologicalSorting (const std::vector <NodeId> &, const BasicGraphAdjList <NodeId> &, unsigned int); \
+  template bool checkTopologicalSorting (const std::vector <NodeId> &, const BasicGraphCSR <NodeId> &, unsigned int); \
+  template bool checkTopologicalSorting (const std::vector <NodeId> &, const BasicGraphCompressed <NodeId> &, unsigned int); \
+  template BasicGraphAdjList <NodeId> createGraphAdjListFromEdges (const std::vector <BasicEdge <NodeId>> &); \
+  template BasicGraphCSR <NodeId> createGraphCSRFromEdges (const std::vector <BasicEdge <NodeId>> &); \
+  template BasicGraphCSR <NodeId> createGraphCSRFromEdgesParallel (const std::vector <BasicEdge <NodeId>> &, unsigned int); \
+  template void createGraphCSRFromEdgesParallel (const std::vector <BasicEdge <NodeId>> &, BasicGraphCSR <NodeId> &, BasicGraphCSR <NodeId> &, unsigned int); \
+  template BasicGraphCompressed <NodeId> createGraphCompressedFromEdges (const std::vector <BasicEdge <NodeId>> &); \
+  template BasicGraphCompressed <NodeId> createGraphCompressedFromCSR (const BasicGraphCSR <NodeId> &); \
+  template NodeId getMaxNodeId (const std::vector <BasicEdge <NodeId>> &);
+
+INSTANTIATE_NODE_ID_FUNCTIONS (uint16_t)
+INSTANTIATE_NODE_ID_FUNCTIONS (uint32_t)
+INSTANTIATE_NODE_ID_FUNCTIONS (uint64_t)
+
 
 
 
@@ -0,0 +1,113 @@
+#include "trace.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+// event of the trace, either a scope or a counter
+struct TraceEvent {
+  bool isCounter;
+  const char * name;
+  unsigned int threadId;
+  uint64_t startNs;
+  // duration of a scope or value of a counter
+  uint64_t value;
+};
+
+// the events of all threads
+// NOTE: Only the phases are recorded, not single nodes or edges, so a mutex is cheap enough.
+static std::mutex traceMutex;
+static std::vector <TraceEvent> traceEvents;
+
+// Function to give the nanoseconds since the first use of the trace
+static uint64_t getTraceTime (void) {
+  static const auto epoch = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast <std::chrono::nanoseconds> (std::chrono::steady_clock::now() - epoch).count();
+}
+
+// Function to give a small id of the calling thread, numbered in the order of their first event
+static unsigned int getTraceThreadId (void) {
+  static std::atomic <unsigned int> nThreads (0);
+  thread_local unsigned int threadId = nThreads++;
+  return threadId;
+}
+
+static void recordTraceEvent (const TraceEvent & event) {
+  std::lock_guard <std::mutex> lock (traceMutex);
+  traceEvents.push_back (event);
+}
+
+TraceScope::TraceScope (const char * name)
+  : _name (name)
+  , _startNs (getTraceTime())
+{}
+
+TraceScope::~TraceScope () {
+  stop();
+}
+
+void TraceScope::stop (void) {
+  if (! _name)
+    return;
+
+  recordTraceEvent (TraceEvent {false, _name, getTraceThreadId(), _startNs, getTraceTime() - _startNs});
+  _name = nullptr;
+}
+
+void recordTraceCounter (const char * name, const uint64_t value) {
+  recordTraceEvent (TraceEvent {true, name, getTraceThreadId(), getTraceTime(), value});
+}
+
+void clearTrace (void) {
+  std::lock_guard <std::mutex> lock (traceMutex);
+  traceEvents.clear();
+}
+
+std::size_t getTraceSize (void) {
+  std::lock_guard <std::mutex> lock (traceMutex);
+  return traceEvents.size();
+}
+
+// Function to write all events using 'writeEvent (oFile, event, isLast)'
+template <typename WriteEvent>
+static void writeTrace (const std::string & filename, const char * header, const char * footer, WriteEvent writeEvent) {
+  std::lock_guard <std::mutex> lock (traceMutex);
+
+  auto oFile = std::fopen (filename.c_str(), "w");
+  if (! oFile)
+    throw std::runtime_error ("Error: Cannot create output file " + filename);
+
+  std::fputs (header, oFile);
+  for (std::size_t i = 0; i < traceEvents.size(); i++)
+    writeEvent (oFile, traceEvents[i], i + 1 == traceEvents.size());
+  std::fputs (footer, oFile);
+
+  if (std::fclose (oFile) != 0)
+    throw std::runtime_error ("Error: Cannot write the trace into file " + filename);
+}
+
+void writeTraceChromeJSON (const std::string & filename) {
+  writeTrace (filename, "{\"traceEvents\": [\n", "], \"displayTimeUnit\": \"ns\"}\n", [](FILE * oFile, const TraceEvent & event, const bool isLast) {
+    if (event.isCounter)
+      std::fprintf (oFile, "  {\"name\": \"%s\", \"ph\": \"C\", \"pid\": 0, \"tid\": %u, \"ts\": %.3f, \"args\": {\"value\": %llu}}"
+                  , event.name, event.threadId, event.startNs / 1000.0, (unsigned long long) event.value);
+    else
+      std::fprintf (oFile, "  {\"name\": \"%s\", \"ph\": \"X\", \"pid\": 0, \"tid\": %u, \"ts\": %.3f, \"dur\": %.3f}"
+                  , event.name, event.threadId, event.startNs / 1000.0, event.value / 1000.0);
+    std::fputs (isLast ? "\n" : ",\n", oFile);
+  });
+}
+
+void writeTraceCSV (const std::string & filename) {
+  writeTrace (filename, "type,name,thread,start_ns,duration_ns,value\n", "", [](FILE * oFile, const TraceEvent & event, const bool) {
+    if (event.isCounter)
+      std::fprintf (oFile, "counter,%s,%u,%llu,,%llu\n", event.name, event.threadId
+                  , (unsigned long long) event.startNs, (unsigned long long) event.value);
+    else
+      std::fprintf (oFile, "scope,%s,%u,%llu,%llu,\n", event.name, event.threadId
+                  , (unsigned long long) event.startNs, (unsigned long long) event.value);
+  });
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "BatchSorter.h"
+#include "random-dag.h"
+#include "topological-sort.h"
+
+TEST (correctness, batchSorter) {
+  // graphs of different sizes, so the threads get different amounts of work
+  std::vector <GraphCSR> csrDags;
+  std::vector <GraphAdjList> adjListDags;
+  for (unsigned int i = 0; i < 200; i++) {
+    auto edges = createRandomDAGEdges (1 + (i * 37) % 300, 0.05, i);
+    csrDags.push_back (createGraphCSRFromEdges (edges));
+    adjListDags.push_back (createGraphAdjListFromEdges (edges));
+  }
+
+  BatchSorter sorter (4);
+  ASSERT_EQ (sorter.nThreads(), 4u);
+
+  // the results are the same as the ones of the single-graph functions, also for later batches
+  for (unsigned int batch = 0; batch < 3; batch++) {
+    auto results = sorter.sort (csrDags);
+    ASSERT_EQ (results.size(), csrDags.size());
+    for (std::size_t i = 0; i < csrDags.size(); i++) {
+      ASSERT_TRUE (results[i].isSorted());
+      ASSERT_EQ (results[i].sorting, topologicalSortCSR (csrDags[i]));
+    }
+
+    results = sorter.sort (csrDags, BatchSortAlgorithm::CORMAN);
+    for (std::size_t i = 0; i < csrDags.size(); i++)
+      ASSERT_EQ (results[i].sorting, topologicalSortCormanCSR (csrDags[i]));
+
+    results = sorter.sort (adjListDags);
+    for (std::size_t i = 0; i < adjListDags.size(); i++)
+      ASSERT_EQ (results[i].sorting, topologicalSortAdjList4 (adjListDags[i]));
+
+    results = sorter.sort (adjListDags, BatchSortAlgorithm::CORMAN);
+    for (std::size_t i = 0; i < adjListDags.size(); i++)
+      ASSERT_EQ (results[i].sorting, topologicalSortCormanAdjList3 (adjListDags[i]));
+  }
+
+  ASSERT_TRUE (sorter.sort (std::vector <GraphCSR> ()).empty());
+}
+
+TEST (correctness, batchSorter_cycle) {
+  std::vector <GraphCSR> dags;
+  for (unsigned int i = 0; i < 50; i++)
+    dags.push_back (createRandomDAGCSR (100, 0.1, i));
+  // the graph in the middle has the cycle 1 -> 2 -> 3 -> 1
+  dags[25] = createGraphCSRFromEdges (std::vector <Edge> ({Edge (0, 1), Edge (1, 2), Edge (2, 3), Edge (3, 1)}));
+
+  BatchSorter sorter (3);
+  for (auto algorithm : {BatchSortAlgorithm::KAHN, BatchSortAlgorithm::CORMAN}) {
+    auto results = sorter.sort (dags, algorithm);
+    for (std::size_t i = 0; i < dags.size(); i++)
+      ASSERT_EQ (results[i].isSorted(), i != 25);
+
+    ASSERT_TRUE (results[25].sorting.empty());
+    
+    // the cycle is the one found by the single-graph functions
+    std::vector <unsigned int> expectedCycle;
+    try {
+      if (algorithm == BatchSortAlgorithm::KAHN)
+        topologicalSortCSR (dags[25]);
+      else
+        topologicalSortCormanCSR (dags[25]);
+      FAIL();
+    } catch (const GraphCycleException & e) {
+      expectedCycle = e.cycle();
+    }
+    
+    try {
+      std::rethrow_exception (results[25].error);
+      FAIL();
+    } catch (const GraphCycleException & e) {
+      ASSERT_EQ (e.cycle().size(), 3u);
+      ASSERT_EQ (e.cycle(), expectedCycle);
+    }
+
+    // the other graphs are not affected by the cycle
+    for (std::size_t i = 0; i < dags.size(); i++) {
+      if (i != 25) {
+        ASSERT_EQ (checkTopologicalSorting (results[i].sorting, dags[i]), true);
+      }
+    }
+  }
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "DenseIdMap.h"
+#include "random-dag.h"
+#include "topological-sort.h"
+
+TEST (correctness, denseIdMap) {
+  DenseIdMap <uint64_t> ids;
+  
+  // the ids are given in the order the keys are seen first
+  ASSERT_EQ (ids.insert (4000000000ull), 0u);
+  ASSERT_EQ (ids.insert (0), 1u);
+  ASSERT_EQ (ids.insert (4000000000ull), 0u);
+  ASSERT_EQ (ids.size(), 2u);
+  
+  // keys with equal low bits, so the table has to grow several times
+  for (uint64_t i = 0; i < 10000; i++)
+    ASSERT_EQ (ids.insert ((i + 1) << 40), i + 2);
+  for (uint64_t i = 0; i < 10000; i++) {
+    unsigned int id;
+    ASSERT_EQ (ids.find ((i + 1) << 40, id), true);
+    ASSERT_EQ (id, i + 2);
+    ASSERT_EQ (ids.key (id), (i + 1) << 40);
+  }
+  
+  unsigned int id;
+  ASSERT_EQ (ids.find (12345, id), false);
+  ASSERT_THROW (ids.key (ids.size()), std::invalid_argument);
+  
+  // the amount of keys has to fit into the node-id type
+  DenseIdMap <uint64_t, uint16_t> smallIds;
+  for (uint64_t i = 0; i < 65535; i++)
+    smallIds.insert (i);
+  ASSERT_THROW (smallIds.insert (65535), std::invalid_argument);
+}
+
+TEST (correctness, denseIdMap_sortWithKeys) {
+  // a random DAG with sparse keys
+  auto edges = createRandomDAGEdges (500, 0.05, 7);
+  std::vector <std::pair <std::string, std::string>> keyedEdges;
+  for (auto & edge : edges)
+    keyedEdges.push_back (std::make_pair ("job-" + std::to_string (edge.first), "job-" + std::to_string (edge.second)));
+  
+  DenseIdMap <std::string> ids;
+  auto denseEdges = ids.insertEdges (keyedEdges);
+  auto dag = createGraphCSRFromEdges (denseEdges);
+  ASSERT_EQ (dag.nNodes(), ids.size());
+  
+  // every keyed edge has to point forward within the translated sorting
+  auto sorting = ids.translate (topologicalSortCSR (dag));
+  ASSERT_EQ (sorting.size(), ids.size());
+  std::map <std::string, std::size_t> position;
+  for (std::size_t i = 0; i < sorting.size(); i++)
+    position[sorting[i]] = i;
+  for (auto & edge : keyedEdges)
+    ASSERT_LT (position[edge.first], position[edge.second]);
+}
+
+TEST (correctness, readEdgesWithKeysFromFile) {
+  {
+    std::ofstream oFile ("denseIdMap_unittest.dat");
+    oFile << "18446744073709551615 7\n7 4000000000\n\n18446744073709551615 4000000000\n";
+  }
+  
+  DenseIdMap <uint64_t> ids;
+  auto edges = readEdgesWithSparseIdsFromFile ("denseIdMap_unittest.dat", ids);
+  ASSERT_EQ (edges, std::vector <Edge> ({Edge (0, 1), Edge (1, 2), Edge (0, 2)}));
+  ASSERT_EQ (ids.keys(), std::vector <uint64_t> ({18446744073709551615ull, 7, 4000000000ull}));
+  
+  DenseIdMap <std::string> names;
+  edges = readEdgesWithKeysFromFile ("denseIdMap_unittest.dat", names);
+  ASSERT_EQ (edges, std::vector <Edge> ({Edge (0, 1), Edge (1, 2), Edge (0, 2)}));
+  ASSERT_EQ (names.key (2), "4000000000");
+  
+  // a key larger than 64 bits stops the parsing
+  {
+    std::ofstream oFile ("denseIdMap_unittest.dat");
+    oFile << "18446744073709551616 2\n1 2\n";
+  }
+  ids = DenseIdMap <uint64_t> ();
+  ASSERT_EQ (readEdgesWithSparseIdsFromFile ("denseIdMap_unittest.dat", ids).size(), 0u);
+  ASSERT_EQ (ids.size(), 0u);
+  names = DenseIdMap <std::string> ();
+  ASSERT_EQ (readEdgesWithKeysFromFile ("denseIdMap_unittest.dat", names).size(), 2u);
+  ASSERT_EQ (names.key (0), "18446744073709551616");
+  
+  // so does a key, which is not a number
+  {
+    std::ofstream oFile ("denseIdMap_unittest.dat");
+    oFile << "1 2\nname build\n3 4\n";
+  }
+  ids = DenseIdMap <uint64_t> ();
+  ASSERT_EQ (readEdgesWithSparseIdsFromFile ("denseIdMap_unittest.dat", ids), std::vector <Edge> ({Edge (0, 1)}));
+  names = DenseIdMap <std::string> ();
+  ASSERT_EQ (readEdgesWithKeysFromFile ("denseIdMap_unittest.dat", names).size(), 3u);
+  ASSERT_EQ (names.key (2), "name");
+  
+  std::remove ("denseIdMap_unittest.dat");
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <vector>
+
+#include "DynamicTopologicalOrder.h"
+#include "topological-sort.h"
+
+TEST (correctness, dynamicTopologicalOrder_insertEdge) {
+  auto dag = createGraphAdjListFromEdges (readEdgesFromFile ("example-graphs/t1-graph.dat"));
+  DynamicTopologicalOrder order (dag);
+  
+  ASSERT_EQ (order.nNodes(), 7);
+  ASSERT_EQ (checkTopologicalSorting (order.order(), order.graph()), true);
+  
+  // edges, which need the sorting to be repaired
+  for (auto e : {Edge (1, 0), Edge (4, 3), Edge (0, 2), Edge (4, 2)}) {
+    ASSERT_EQ (order.insertEdge (e), true);
+    ASSERT_EQ (order.graph().containsEdge (e), true);
+    ASSERT_EQ (order.position (e.first) < order.position (e.second), true);
+    ASSERT_EQ (checkTopologicalSorting (order.order(), order.graph()), true);
+  }
+  
+  // edges, which would close a cycle
+  for (auto e : {Edge (3, 6), Edge (2, 3), Edge (2, 2)}) {
+    auto sorting = order.order();
+    ASSERT_EQ (order.insertEdge (e), false);
+    ASSERT_EQ (order.graph().containsEdge (e), false);
+    ASSERT_EQ (order.order(), sorting);
+  }
+  
+  // after deleting an edge, the reversed one can be inserted
+  order.deleteEdge (Edge (0, 2));
+  ASSERT_EQ (order.graph().containsEdge (Edge (0, 2)), false);
+  ASSERT_EQ (order.insertEdge (Edge (2, 0)), true);
+  ASSERT_EQ (checkTopologicalSorting (order.order(), order.graph()), true);
+  
+  ASSERT_THROW (order.insertEdge (Edge (7, 0)), std::invalid_argument);
+}
+
+TEST (correctness, dynamicTopologicalOrder_randomEdges) {
+  const unsigned int nNodes = 200;
+  GraphAdjList dag (nNodes);
+  DynamicTopologicalOrder order (dag);
+  
+  srand (1);
+  for (unsigned int i = 0; i < 2000; i++) {
+    Edge e (rand() % nNodes, rand() % nNodes);
+    
+    // the edge closes a cycle, if and only if the graph with the edge can not be sorted
+    GraphAdjList dagWithEdge (order.graph());
+    dagWithEdge.insertEdge (e, false);
+    bool isDAG = true;
+    try {
+      topologicalSortAdjList4 (dagWithEdge);
+    } catch (std::invalid_argument &) {
+      isDAG = false;
+    }
+    
+    ASSERT_EQ (order.insertEdge (e), isDAG);
+    
+    std::vector <unsigned int> position (nNodes);
+    for (unsigned int j = 0; j < nNodes; j++)
+      position[order.order()[j]] = j;
+    for (unsigned int sourceNodeId = 0; sourceNodeId < nNodes; sourceNodeId++) {
+      ASSERT_EQ (order.position (sourceNodeId), position[sourceNodeId]);
+      for (auto targetNodeId : order.graph()[sourceNodeId])
+        ASSERT_EQ (position[sourceNodeId] < position[targetNodeId], true);
+    }
+  }
+}
@@ -0,0 +1,75 @@
+#include "gtest/gtest.h"
+
+#include "NodePool.h"
+#include "random-dag.h"
+#include "topological-sort.h"
+
+#include <forward_list>
+#include <memory>
+#include <vector>
+
+TEST (correctness, nodePool) {
+  auto pool = std::make_shared <NodePool> (4);
+  
+  {
+    std::forward_list <unsigned int, PoolAllocator <unsigned int>> list ((PoolAllocator <unsigned int> (pool.get())));
+    for (unsigned int i = 0; i < 100; i++)
+      list.push_front (i);
+    
+    unsigned int expected = 100;
+    for (auto value : list)
+      ASSERT_EQ (value, --expected);
+    
+    // slabs of 4, 8, 16, 32 and 64 blocks
+    ASSERT_EQ (pool -> nSlabs(), 5u);
+    
+    // freed blocks are reused
+    list.clear();
+    for (unsigned int i = 0; i < 100; i++)
+      list.push_front (i);
+    ASSERT_EQ (pool -> nSlabs(), 5u);
+  }
+  
+  // a reserved slab is large enough for all blocks
+  pool = std::make_shared <NodePool> ();
+  pool -> reserve (1000);
+  std::forward_list <unsigned int, PoolAllocator <unsigned int>> list ((PoolAllocator <unsigned int> (pool.get())));
+  for (unsigned int i = 0; i < 1000; i++)
+    list.push_front (i);
+  ASSERT_EQ (pool -> nSlabs(), 1u);
+  
+  // arrays are not taken from the pool
+  std::vector <unsigned int, PoolAllocator <unsigned int>> vector (1000, 1, PoolAllocator <unsigned int> (pool.get()));
+  ASSERT_EQ (vector.back(), 1u);
+  ASSERT_EQ (pool -> nSlabs(), 1u);
+}
+
+TEST (correctness, graphAdjListPool) {
+  auto edges = createRandomDAGEdges (200, 0.2, 3);
+  auto graph = createGraphAdjListFromEdges (edges);
+  ASSERT_EQ (graph.pool() -> nSlabs(), 1u);
+  
+  // the copy has its own pool, but the same edges in the same order
+  GraphAdjList copy (graph);
+  ASSERT_NE (copy.pool(), graph.pool());
+  for (unsigned int nodeId = 0; nodeId < graph.nNodes(); nodeId++)
+    ASSERT_TRUE (copy[nodeId] == graph[nodeId]);
+  
+  // graphs can share a pool
+  GraphAdjList shared (graph.nNodes(), graph.pool());
+  shared.insertEdge (Edge (0, 1));
+  ASSERT_EQ (shared.pool(), graph.pool());
+  ASSERT_EQ (shared[0].get_allocator().pool(), graph.pool().get());
+  
+  // the lists of a moved graph keep their pool
+  GraphAdjList moved (std::move (shared));
+  ASSERT_EQ (moved[0].get_allocator().pool(), graph.pool().get());
+  ASSERT_EQ (moved[0].front(), 1u);
+  
+  // a list head only adds the pointer to the pool to the one of std::forward_list
+  ASSERT_EQ (sizeof (GraphAdjList::AdjacencyList), sizeof (std::forward_list <unsigned int>) + sizeof (NodePool *));
+  
+  auto L = topologicalSortAdjList3 (graph);
+  ASSERT_TRUE (checkTopologicalSorting (L, graph));
+  ASSERT_FALSE (graph.isEmpty());
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "binary-edge-file.h"
+#include "topological-sort.h"
+
+TEST (correctness, binaryEdgeFile_writeRead) {
+  const std::string filename = "binary-edge-file_unittest.bin";
+  
+  {
+    auto edges = readEdgesFromFile ("example-graphs/t1-graph.dat");
+    writeEdgesToBinaryFile (filename, edges);
+    
+    BinaryEdgeFileHeader header;
+    ASSERT_EQ (readEdgesFromBinaryFile (filename, header), edges);
+    ASSERT_EQ (header.version, BINARY_EDGE_FILE_VERSION);
+    ASSERT_EQ (header.idWidth, 2);
+    ASSERT_EQ (header.nNodes, 7);
+    ASSERT_EQ (header.nEdges, edges.size());
+    ASSERT_EQ (header.flags, SORTED_BY_SOURCE | DEDUPLICATED);
+  }
+  
+  {
+    std::vector <Edge> edges ({Edge (2, 100000), Edge (1, 0), Edge (1, 0)});
+    writeEdgesToBinaryFile (filename, edges);
+    
+    auto header = readBinaryEdgeFileHeader (filename);
+    ASSERT_EQ (readEdgesFromBinaryFile (filename), edges);
+    ASSERT_EQ (header.idWidth, 4);
+    ASSERT_EQ (header.nNodes, 100001);
+    ASSERT_EQ (header.flags, 0);
+  }
+  
+  {
+    writeEdgesToBinaryFile (filename, std::vector <Edge> ());
+    
+    auto header = readBinaryEdgeFileHeader (filename);
+    ASSERT_EQ (readEdgesFromBinaryFile (filename).size(), 0);
+    ASSERT_EQ (header.nNodes, 0);
+    ASSERT_EQ (header.nEdges, 0);
+  }
+  
+  {
+    // a text file is not a binary edge file
+    ASSERT_THROW (readEdgesFromBinaryFile ("example-graphs/t1-graph.dat"), std::invalid_argument);
+  }
+  
+  std::remove (filename.c_str());
+}
+
+TEST (correctness, binaryEdgeFile_readGraphCSR) {
+  const std::string filename = "binary-edge-file_unittest.bin";
+  
+  // sorted and unsorted edges
+  for (auto edges : {readEdgesFromFile ("example-graphs/t1-graph.dat")
+                   , std::vector <Edge> ({Edge (3, 4), Edge (0, 2), Edge (3, 1), Edge (0, 6)})}) {
+    writeEdgesToBinaryFile (filename, edges);
+    
+    auto dag = readGraphCSRFromBinaryFile (filename);
+    auto reference = createGraphCSRFromEdges (edges);
+    ASSERT_EQ (dag.offsets(), reference.offsets());
+    ASSERT_EQ (dag.targets(), reference.targets());
+  }
+  
+  std::remove (filename.c_str());
+}
+
+TEST (correctness, binaryEdgeFile_convert) {
+  const std::string binaryFilename = "binary-edge-file_unittest.bin";
+  const std::string textFilename = "binary-edge-file_unittest.dat";
+  
+  convertTextToBinaryEdgeFile ("example-graphs/t1-graph.dat", binaryFilename);
+  convertBinaryToTextEdgeFile (binaryFilename, textFilename);
+  
+  ASSERT_EQ (readEdgesFromFile (textFilename), readEdgesFromFile ("example-graphs/t1-graph.dat"));
+  
+  std::remove (binaryFilename.c_str());
+  std::remove (textFilename.c_str());
+}
+
+TEST (correctness, binaryEdgeFile_sortBySource) {
+  const std::string filename = "binary-edge-file_unittest.bin";
+  const std::string sortedFilename = "binary-edge-file_unittest.sorted.bin";
+  
+  std::vector <Edge> edges;
+  for (unsigned int i = 0; i < 1000; i++)
+    edges.push_back (Edge ((i * 7919) % 300, (i * 104729) % 70000));
+  writeEdgesToBinaryFile (filename, edges);
+  
+  // a budget of 100 edges gives 10 runs
+  sortBinaryEdgeFileBySource (filename, sortedFilename, 100 * sizeof (Edge));
+  
+  auto header = readBinaryEdgeFileHeader (sortedFilename);
+  ASSERT_EQ (header.nNodes, readBinaryEdgeFileHeader (filename).nNodes);
+  ASSERT_EQ (header.flags & SORTED_BY_SOURCE, SORTED_BY_SOURCE);
+  
+  std::sort (edges.begin(), edges.end());
+  ASSERT_EQ (readEdgesFromBinaryFile (sortedFilename), edges);
+  
+  // no temporary run is left
+  ASSERT_EQ (std::fopen ((sortedFilename + ".run0").c_str(), "rb"), nullptr);
+  
+  std::remove (filename.c_str());
+  std::remove (sortedFilename.c_str());
+}
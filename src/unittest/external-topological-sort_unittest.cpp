@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <vector>
+
+#include "binary-edge-file.h"
+#include "external-topological-sort.h"
+#include "topological-sort.h"
+
+TEST (correctness, topologicalSortExternal) {
+  const std::string edgeFilename = "external-topological-sort_unittest.bin";
+  const std::string orderFilename = "external-topological-sort_unittest.order";
+  
+  // sorted edges are processed directly, unsorted ones are sorted with a small budget first
+  std::vector <Edge> layeredEdges;
+  for (unsigned int layer = 0; layer < 20; layer++)
+    for (unsigned int i = 0; i < 100; i++)
+      layeredEdges.push_back (Edge ((layer + 1) * 100 + (i * 37) % 100, layer * 100 + i));
+  
+  for (auto edges : {readEdgesFromFile ("example-graphs/t1-graph.dat"), layeredEdges}) {
+    writeEdgesToBinaryFile (edgeFilename, edges);
+    topologicalSortExternal (edgeFilename, orderFilename, 64 * sizeof (Edge));
+    
+    auto L = readTopologicalSortingFromFile (orderFilename);
+    ASSERT_EQ (checkTopologicalSorting (L, createGraphCSRFromEdges (edges)), true);
+  }
+  
+  {
+    auto edges = layeredEdges;
+    edges.push_back (Edge (0, 2000));
+    writeEdgesToBinaryFile (edgeFilename, edges);
+    
+    ASSERT_THROW (topologicalSortExternal (edgeFilename, orderFilename, 64 * sizeof (Edge)), std::invalid_argument);
+    ASSERT_EQ (std::fopen (orderFilename.c_str(), "rb"), nullptr);
+  }
+  
+  std::remove (edgeFilename.c_str());
+  std::remove (orderFilename.c_str());
+}
+
+TEST (correctness, topologicalSortExternal_io) {
+  const std::string edgeFilename = "external-topological-sort_unittest.bin";
+  const std::string orderFilename = "external-topological-sort_unittest.order";
+  const std::size_t memoryBudget = 64 * sizeof (Edge);
+  
+  // edges of 20 layers of 100 nodes each
+  std::vector <Edge> forwardEdges, backwardEdges;
+  for (unsigned int layer = 0; layer < 20; layer++) {
+    for (unsigned int i = 0; i < 100; i++) {
+      forwardEdges.push_back (Edge (layer * 100 + i, (layer + 1) * 100 + (i * 37) % 100));
+      backwardEdges.push_back (Edge ((layer + 1) * 100 + (i * 37) % 100, layer * 100 + i));
+    }
+  }
+  
+  // edges to later blocks only are sorted within a single pass over the file
+  writeEdgesToBinaryFile (edgeFilename, forwardEdges);
+  const uint64_t nBytes = forwardEdges.size() * 2 * readBinaryEdgeFileHeader (edgeFilename).idWidth;
+  ExternalSortStatistics statistics;
+  topologicalSortExternal (edgeFilename, orderFilename, memoryBudget, statistics);
+  ASSERT_EQ (checkTopologicalSorting (readTopologicalSortingFromFile (orderFilename), createGraphCSRFromEdges (forwardEdges)), true);
+  ASSERT_EQ (statistics.nPasses, 1u);
+  ASSERT_EQ (statistics.nBytesRead, 2 * nBytes);
+  
+  // every layer goes back to earlier blocks, so every layer needs another pass
+  writeEdgesToBinaryFile (edgeFilename, backwardEdges);
+  topologicalSortExternal (edgeFilename, orderFilename, memoryBudget, statistics);
+  ASSERT_EQ (checkTopologicalSorting (readTopologicalSortingFromFile (orderFilename), createGraphCSRFromEdges (backwardEdges)), true);
+  ASSERT_GT (statistics.nPasses, 1u);
+  ASSERT_LE (statistics.nPasses, 21u);
+  ASSERT_LE (statistics.nBytesRead, (1 + statistics.nPasses) * nBytes);
+  
+  // a single block can not be read at once, if a node has more edges than fit into the budget
+  std::vector <Edge> starEdges;
+  for (unsigned int i = 1; i < 1000; i++)
+    starEdges.push_back (Edge (0, i));
+  writeEdgesToBinaryFile (edgeFilename, starEdges);
+  topologicalSortExternal (edgeFilename, orderFilename, memoryBudget, statistics);
+  ASSERT_EQ (checkTopologicalSorting (readTopologicalSortingFromFile (orderFilename), createGraphCSRFromEdges (starEdges)), true);
+  ASSERT_EQ (statistics.nPasses, 1u);
+  
+  std::remove (edgeFilename.c_str());
+  std::remove (orderFilename.c_str());
+}
@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <vector>
+
+#include "meter.h"
+
+// function doing some work to be measured
+static uint64_t sumOfSquares (uint64_t n) {
+  volatile uint64_t sum = 0;
+  for (uint64_t i = 0; i < n; i++)
+    sum += i * i;
+  return sum;
+}
+
+TEST (correctness, perfCounters) {
+  std::function <uint64_t (uint64_t)> f = sumOfSquares;
+  auto measurements = benchmark <PerfCounters, PerfCounters, uint64_t, uint64_t> (myPerfCounters, 3, f, 1000000);
+  ASSERT_EQ (measurements.size(), 3);
+  
+  for (auto & measurement : measurements) {
+    // counters, which are not available, stay zero
+    for (int counter = 0; counter < N_PERF_COUNTERS; counter++)
+      if (! measurement.isAvailable (PerfCounter (counter))) {
+        ASSERT_EQ (measurement[PerfCounter (counter)], 0);
+      }
+    
+    ASSERT_EQ (measurement.available != 0, hasPerfCounters());
+    if (measurement.isAvailable (PERF_INSTRUCTIONS)) {
+      ASSERT_GT (measurement[PERF_INSTRUCTIONS], 1000000);
+    }
+  }
+  
+  Matrix <PerfCounters> matrix (1, 3, PerfCounters());
+  for (unsigned int run = 0; run < 3; run++)
+    matrix (0, run) = measurements[run];
+  
+  auto instructions = selectPerfCounter (matrix, PERF_INSTRUCTIONS);
+  for (unsigned int run = 0; run < 3; run++)
+    ASSERT_EQ (instructions (0, run), measurements[run][PERF_INSTRUCTIONS]);
+  
+  ASSERT_STREQ (getPerfCounterName (PERF_LLC_MISSES), "llc_misses");
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "random-dag.h"
+#include "topological-sort.h"
+
+// function to check, whether the given edges form a DAG without duplicated edges
+bool isSimpleDAG (std::vector <Edge> edges) {
+  if (edges.empty())
+    return true;
+  
+  auto dag = createGraphCSRFromEdges (edges);
+  if (! findCycle (dag).empty())
+    return false;
+  
+  std::sort (edges.begin(), edges.end());
+  return std::adjacent_find (edges.begin(), edges.end()) == edges.end();
+}
+
+TEST (correctness, randomDAG_lowerTriangular) {
+  ASSERT_EQ (createRandomDAGEdges (0, 0.5).size(), 0);
+  ASSERT_EQ (createRandomDAGEdges (1, 0.5).size(), 0);
+  ASSERT_EQ (createRandomDAGEdges (100, 0.0).size(), 0);
+  ASSERT_EQ (createRandomDAGEdges (100, 1.0).size(), 100 * 99 / 2);
+  
+  // the same seed gives the same graph
+  ASSERT_EQ (createRandomDAGEdges (300, 0.3, 7), createRandomDAGEdges (300, 0.3, 7));
+  ASSERT_NE (createRandomDAGEdges (300, 0.3, 7), createRandomDAGEdges (300, 0.3, 8));
+  
+  auto edges = createRandomDAGEdges (1000, 0.1, 3);
+  ASSERT_EQ (isSimpleDAG (edges), true);
+  ASSERT_EQ (std::is_sorted (edges.begin(), edges.end()), true);
+  for (auto & edge : edges)
+    ASSERT_GT (edge.first, edge.second);
+  
+  // the amount of edges is close to the expected one (49950, the deviation is about 220)
+  ASSERT_NEAR (edges.size(), 0.1 * 1000 * 999 / 2, 2000);
+  
+  // the graph in the compressed sparse row format is the same
+  auto dag = createRandomDAGCSR (1000, 0.1, 3);
+  auto reference = createGraphCSRFromEdges (edges);
+  ASSERT_EQ (dag.offsets(), reference.offsets());
+  ASSERT_EQ (dag.targets(), reference.targets());
+}
+
+TEST (correctness, randomDAG_moreRandom) {
+  ASSERT_EQ (createMoreRandomDAGEdges (1, 0.5).size(), 0);
+  ASSERT_EQ (createMoreRandomDAGEdges (64, 1.0, 1, 4).size(), 64 * 63 / 2);
+  ASSERT_EQ (createMoreRandomDAGEdges (500, 0.4, 2), createMoreRandomDAGEdges (500, 0.4, 2));
+  
+  for (unsigned int nNodes : {7, 100, 513})
+    ASSERT_EQ (isSimpleDAG (createMoreRandomDAGEdges (nNodes, 0.75, nNodes)), true);
+}
+
+TEST (correctness, randomDAG_families) {
+  {
+    auto edges = createChainDAGEdges (1000);
+    ASSERT_EQ (edges.size(), 999);
+    ASSERT_EQ (topologicalSortLevels (createGraphCSRFromEdges (edges)).nLevels(), 1000);
+  }
+  
+  {
+    auto edges = createTreeDAGEdges (1000, 5);
+    ASSERT_EQ (edges.size(), 999);
+    ASSERT_EQ (isSimpleDAG (edges), true);
+    
+    // every node but the root has exactly one parent
+    auto inDegree = getInDegree (createGraphCSRFromEdges (edges));
+    ASSERT_EQ (inDegree[0], 0);
+    ASSERT_EQ (std::count (inDegree.begin(), inDegree.end(), 1), 999);
+  }
+  
+  {
+    auto edges = createLayeredDAGEdges (10, 100, 3);
+    ASSERT_EQ (edges.size(), 9 * 100 * 3);
+    ASSERT_EQ (topologicalSortLevels (createGraphCSRFromEdges (edges)).nLevels(), 10);
+  }
+  
+  {
+    auto edges = createPowerLawDAGEdges (10000, 3, 9);
+    ASSERT_EQ (isSimpleDAG (edges), true);
+    
+    // a few nodes get many successors
+    auto dag = createGraphCSRFromEdges (edges);
+    unsigned int maxOutDegree = 0;
+    for (unsigned int nodeId = 0; nodeId < dag.nNodes(); nodeId++)
+      maxOutDegree = std::max <unsigned int> (maxOutDegree, dag.outDegree (nodeId));
+    ASSERT_GT (maxOutDegree, 100);
+  }
+  
+  {
+    auto edges = createRandomDAGEdges (200, 0.2);
+    auto permutedEdges = edges;
+    permuteNodeIds (permutedEdges, 200, 4);
+    
+    ASSERT_NE (permutedEdges, edges);
+    ASSERT_EQ (permutedEdges.size(), edges.size());
+    ASSERT_EQ (isSimpleDAG (permutedEdges), true);
+  }
+}
@@ -1,12 +1,16 @@
 #include <gtest/gtest.h>
 
+#include <fstream>
 #include <functional>
 #include <iostream>
+#include <set>
 #include <sys/stat.h>
 #include <vector>
 #include <cstdlib>
+#include <cstdio>
 
 #include "meter.h"
+#include "random-dag.h"
 #include "topological-sort.h"
 
 
@@ -34,22 +38,24 @@ void fillWith2ndPower (const unsigned int from, const unsigned int to, std::vect
     oVector.push_back (pow (2, i));
 }
 
-std::string createRandomDAG (const float epsilon,  unsigned int seed = 1) {
-  std::string dagFilename = "/home/bach/Documents/algorithm-exercises/topological-sorting/example-graphs/test-graph.dat";
-  
+// function to create a random DAG with a random amount of nodes
+std::vector <Edge> createRandomDAG (const float epsilon, unsigned int seed = 1) {
   unsigned int nNodes = rand() % 512;
   
-  char buffer[2048];
-  sprintf (buffer
-  , "Rscript scripts/createRandomDAG.R %i %.1f %s %i"
-  , nNodes
-  , epsilon
-  , dagFilename.c_str()
-  , seed);
-  if (system ((char *) buffer))
-    throw std::invalid_argument ("Something went wrong in the R script.");
+  return createRandomDAGEdges (nNodes, epsilon, seed);
+}
+
+// function to check, whether 'cycle' is a cycle of the graph given by 'edges'
+bool isCycle (const std::vector <unsigned int> & cycle, const std::vector <Edge> & edges) {
+  if (cycle.empty())
+    return false;
+  
+  auto graph = createGraphCSRFromEdges (edges);
+  for (unsigned int i = 0; i < cycle.size(); i++)
+    if (! graph.containsEdge (Edge (cycle[i], cycle[(i + 1) % cycle.size()])))
+      return false;
   
-  return dagFilename;
+  return true;
 }
 
 // test I/O routines
@@ -82,6 +88,108 @@ TEST (correctness, readGraphFromFile) {
 //   negDagAdjList.printGraph();
 }
 
+TEST (correctness, readEdgesFromMappedFile) {
+  ReadStatistics statistics;
+  auto edges = readEdgesFromMappedFile ("example-graphs/t1-graph.dat", statistics);
+  
+  ASSERT_EQ (edges, readEdgesFromFile ("example-graphs/t1-graph.dat"));
+  ASSERT_EQ (edges.size(), 9);
+  ASSERT_EQ (edges.front(), Edge (3, 1));
+  ASSERT_EQ (edges.back(), Edge (6, 4));
+  ASSERT_EQ (statistics.nBytes > 0, true);
+  
+  ASSERT_THROW (readEdgesFromMappedFile ("example-graphs/not-existing.dat", statistics), std::invalid_argument);
+}
+
+TEST (correctness, parseEdges) {
+  {
+    std::string input = "";
+    std::vector <Edge> edges;
+    parseEdges (input.data(), input.data() + input.size(), edges);
+    ASSERT_EQ (edges.size(), 0);
+  }
+  
+  {
+    // WHITESPACE and NEWLINE are delimiters
+    std::string input = " 0 1\n2\t3\r\n\n 4\n5 \n";
+    std::vector <Edge> edges;
+    auto stop = parseEdges (input.data(), input.data() + input.size(), edges);
+    ASSERT_EQ (edges, std::vector <Edge> ({Edge (0, 1), Edge (2, 3), Edge (4, 5)}));
+    ASSERT_EQ (stop, input.data() + input.size());
+  }
+  
+  {
+    // a source node without target node is ignored
+    std::string input = "0 1\n2";
+    std::vector <Edge> edges;
+    parseEdges (input.data(), input.data() + input.size(), edges);
+    ASSERT_EQ (edges, std::vector <Edge> ({Edge (0, 1)}));
+  }
+  
+  {
+    // parsing stops at the first invalid node-id
+    std::string input = "0 1\n2 x\n3 4\n4294967295 4294967296\n";
+    std::vector <Edge> edges;
+    auto stop = parseEdges (input.data(), input.data() + input.size(), edges);
+    ASSERT_EQ (edges, std::vector <Edge> ({Edge (0, 1)}));
+    ASSERT_EQ (stop, input.data() + 4);
+    
+    input = "4294967295 4294967296\n";
+    edges.clear();
+    parseEdges (input.data(), input.data() + input.size(), edges);
+    ASSERT_EQ (edges.size(), 0);
+  }
+}
+
+TEST (correctness, readEdgesFromFileParallel) {
+  // NOTE: The threads are limited by the size of the file, so the file is large enough for 
+  //       several chunks.
+  std::string content;
+  for (unsigned int i = 0; i < 400000; i++)
+    content += std::to_string (i) + " " + std::to_string (i * 7 + 1) + (i % 3 == 0 ? "\r\n" : "\n");
+  
+  auto writeFile = [](const std::string & text) {
+    std::ofstream oFile ("readEdgesFromFileParallel_unittest.dat");
+    oFile << text;
+  };
+  
+  {
+    writeFile (content);
+    auto edges = readEdgesFromFile ("readEdgesFromFileParallel_unittest.dat");
+    ASSERT_EQ (edges.size(), 400000);
+    for (unsigned int nThreads : {1, 2, 3, 8})
+      ASSERT_EQ (readEdgesFromFileParallel ("readEdgesFromFileParallel_unittest.dat", nThreads), edges);
+  }
+  
+  {
+    // edges spanning a NEWLINE are paired by their position within the whole file
+    std::string text = "5\n";
+    for (unsigned int i = 0; i < 400000; i++)
+      text += std::to_string (i) + "\n";
+    writeFile (text);
+    auto edges = readEdgesFromFile ("readEdgesFromFileParallel_unittest.dat");
+    ASSERT_EQ (edges.size(), 200000);
+    ASSERT_EQ (readEdgesFromFileParallel ("readEdgesFromFileParallel_unittest.dat", 4), edges);
+  }
+  
+  {
+    // parsing stops at the first invalid node-id, even if it is in the middle of the file
+    writeFile (content.substr (0, content.size() / 2) + "x\n" + content.substr (content.size() / 2));
+    auto edges = readEdgesFromFile ("readEdgesFromFileParallel_unittest.dat");
+    ASSERT_LT (edges.size(), 400000);
+    ASSERT_EQ (readEdgesFromFileParallel ("readEdgesFromFileParallel_unittest.dat", 4), edges);
+  }
+  
+  {
+    writeFile ("");
+    ASSERT_EQ (readEdgesFromFileParallel ("readEdgesFromFileParallel_unittest.dat", 4).size(), 0);
+  }
+  
+  std::remove ("readEdgesFromFileParallel_unittest.dat");
+  
+  ASSERT_THROW (readEdgesFromFileParallel ("example-graphs/not-existing.dat"), std::invalid_argument);
+}
+
 // test adjList code
 TEST (correctness, adjList_containsEdge) {
   {
@@ -249,6 +357,32 @@ TEST (correctness, adjList_checkTopologicalSorting) {
   }
 }
 
+TEST (correctness, checkTopologicalSortingParallel) {
+  auto edges = createLayeredDAGEdges (10, 20000, 3);
+  auto dag = createGraphCSRFromEdges (edges);
+  auto dagAdjList = createGraphAdjListFromEdges (edges);
+  
+  auto L = topologicalSortCSR (dag);
+  
+  for (unsigned int nThreads = 1; nThreads <= 4; nThreads++) {
+    ASSERT_EQ (checkTopologicalSorting (L, dag, nThreads), true);
+    ASSERT_EQ (checkTopologicalSorting (L, dagAdjList, nThreads), true);
+  }
+  
+  // a single edge in the wrong direction
+  std::swap (L[0], L.back());
+  for (unsigned int nThreads = 1; nThreads <= 4; nThreads++) {
+    ASSERT_EQ (checkTopologicalSorting (L, dag, nThreads), false);
+    ASSERT_EQ (checkTopologicalSorting (L, dagAdjList, nThreads), false);
+  }
+  std::swap (L[0], L.back());
+  
+  // not a permutation of the nodes
+  L[1] = L[0];
+  ASSERT_EQ (checkTopologicalSorting (L, dag), false);
+  ASSERT_EQ (checkTopologicalSorting (L, dagAdjList), false);
+}
+
 TEST (correctness, adjList_coloring) {
   GraphAdjList graph (10);
   
@@ -481,26 +615,102 @@ TEST (correctness, topologicalSortAdjMatrix) {
   }
   
   {
-    std::string filename = "/home/bach/Documents/algorithm-exercises/topological-sorting/example-graphs/test-graph.dat";
-    
     for (unsigned int i = 0; i < 5; i++) {
       std::cout << "sort random DAG " << (i + 1) << "/5" << std::endl;
       // create a random DAG
-      char buffer[2048];
-      sprintf (buffer
-      , "Rscript scripts/createRandomDAG.R 200 0.6 %s %i"
-      , filename.c_str()
-      , i);
-      if (system ((char *) buffer)) 
-        std::cout << "something went wrong in the R script" << std::endl;
-      
-      Graph dag = createGraphFromEdges (readEdgesFromFile (filename));
+      Graph dag = createGraphFromEdges (createRandomDAGEdges (200, 0.6, i));
       ASSERT_EQ (checkTopologicalSorting (topologicalSort (dag), dag), true);
     }
   }
   
 }
 
+TEST (correctness, bitMatrix) {
+  {
+    BitMatrix matrix;
+    ASSERT_EQ (matrix.nNodes(), 0);
+    ASSERT_EQ (matrix.nWords(), 0);
+  }
+  
+  {
+    BitMatrix matrix (130);
+    ASSERT_EQ (matrix.nWords(), 3);
+    
+    matrix.set (0, 129);
+    matrix.set (64, 129);
+    matrix.set (129, 0);
+    matrix.set (129, 63);
+    matrix.set (129, 64);
+    ASSERT_EQ (matrix (0, 129), true);
+    ASSERT_EQ (matrix (129, 0), true);
+    ASSERT_EQ (matrix (0, 0), false);
+    ASSERT_EQ (matrix.inDegree (129), 2);
+    ASSERT_EQ (matrix.outDegree (129), 3);
+    ASSERT_EQ (matrix.inDegree (0), 1);
+    
+    matrix.set (129, 63, false);
+    ASSERT_EQ (matrix (129, 63), false);
+    ASSERT_EQ (matrix.outDegree (129), 2);
+    ASSERT_EQ (matrix.inDegree (63), 0);
+    
+    ASSERT_THROW (matrix (130, 0), std::invalid_argument);
+  }
+  
+  {
+    Graph graph (3, 3, {
+      0, 1, 1,
+      0, 0, 1,
+      0, 0, 0
+    });
+    auto matrix = createBitMatrixFromGraph (graph);
+    
+    for (unsigned int i = 0; i < 3; i++) for (unsigned int j = 0; j < 3; j++)
+      ASSERT_EQ (matrix (i, j), graph (i, j));
+  }
+}
+
+TEST (correctness, topologicalSortBitMatrix) {
+  {
+    BitMatrix dag;
+    
+    ASSERT_EQ (topologicalSortBitMatrix (dag).size(), 0);
+  }
+  
+  {
+    auto edges = readEdgesFromFile ("example-graphs/t1-graph.dat");
+    
+    auto L = topologicalSortBitMatrix (createBitMatrixFromEdges (edges));
+    ASSERT_EQ (checkTopologicalSorting (L, createGraphFromEdges (edges)), true);
+  }
+  
+  {
+    // dense DAG: every node has an edge to all nodes with a larger id
+    std::vector <Edge> edges;
+    for (unsigned int i = 0; i < 300; i++) for (unsigned int j = i + 1; j < 300; j++)
+      edges.push_back (Edge (299 - i, 299 - j));
+    
+    auto L = topologicalSortBitMatrix (createBitMatrixFromEdges (edges));
+    ASSERT_EQ (checkTopologicalSorting (L, createGraphCSRFromEdges (edges)), true);
+  }
+  
+  {
+    auto edges = createLayeredDAGEdges (20, 20, 4);
+    
+    auto L = topologicalSortBitMatrix (createBitMatrixFromEdges (edges));
+    ASSERT_EQ (checkTopologicalSorting (L, createGraphCSRFromEdges (edges)), true);
+  }
+  
+  {
+    Graph dag (3, 3, {
+      0, 1, 1,
+      0, 0, 1,
+      1, 0, 0
+    });
+    
+    ASSERT_THROW (topologicalSortBitMatrix (createBitMatrixFromGraph (dag)), std::invalid_argument);
+  }
+}
+
 TEST (correctness, topologicalSortAdjList) {
   {
     GraphAdjList posDag;
@@ -510,21 +720,13 @@ TEST (correctness, topologicalSortAdjList) {
   }
   
   {
-    std::string filename = "/home/bach/Documents/algorithm-exercises/topological-sorting/example-graphs/test-graph.dat";
-    
     for (unsigned int i = 0; i < 20; i++) {
       std::cout << "sort random DAG " << (i + 1) << "/20" << std::endl;
       // create a random DAG
-      char buffer[2048];
-      sprintf (buffer
-      , "Rscript scripts/createRandomDAG.R 100 0.5 %s %i"
-      , filename.c_str()
-      , i);
-      if (system ((char *) buffer)) 
-        std::cout << "something went wrong in the R script" << std::endl;
-      
-      std::vector <Edge> posEdges, negEdges;
-      readEdgesFromFile (filename, posEdges, negEdges);
+      auto posEdges = createRandomDAGEdges (100, 0.5, i);
+      std::vector <Edge> negEdges;
+      for (auto & edge : posEdges)
+        negEdges.push_back (Edge (edge.second, edge.first));
       
       auto posDagAdjList = createGraphAdjListFromEdges (posEdges);
       auto negDagAdjList = createGraphAdjListFromEdges (negEdges);
@@ -550,9 +752,10 @@ TEST (correctness, topologicalSortAdjList) {
 //     for (unsigned int i = 0; i < nTests; i++) {
 //       std::cout << "sort random DAG " << (i + 1) << "/" << nTests << std::endl;
 //       
-//       auto filename = createRandomDAG (0.65, i);
-//       std::vector <Edge> posEdges, negEdges;
-//       readEdgesFromFile (filename, posEdges, negEdges);
+//       auto posEdges = createRandomDAG (0.65, i);
+//       std::vector <Edge> negEdges;
+//       for (auto & edge : posEdges)
+//         negEdges.push_back (Edge (edge.second, edge.first));
 //       
 //       auto posDagAdjList = createGraphAdjListFromEdges (posEdges);
 //       auto negDagAdjList = createGraphAdjListFromEdges (negEdges);
@@ -578,9 +781,7 @@ TEST (correctness, topologicalSortAdjList3) {
     for (unsigned int i = 0; i < nTests; i++) {
       std::cout << "sort random DAG " << (i + 1) << "/" << nTests << std::endl;
       
-      auto filename = createRandomDAG (0.65, i);
-      
-      auto edges = readEdgesFromFile (filename);
+      auto edges = createRandomDAG (0.65, i);
       
       auto dagAdjList = createGraphAdjListFromEdges (edges);
       auto L = topologicalSortAdjList3 (dagAdjList);
@@ -589,6 +790,42 @@ TEST (correctness, topologicalSortAdjList3) {
   }
 }
 
+TEST (correctness, topologicalSortAdjList4) {
+  {
+    GraphAdjList posDag;
+    
+    auto L = topologicalSortAdjList4 (posDag);
+    ASSERT_EQ (checkTopologicalSorting (L, posDag), true);
+  }
+  
+  {
+    auto dag = createGraphAdjListFromEdges (readEdgesFromFile ("example-graphs/t1-graph.dat"));
+    
+    auto L = topologicalSortAdjList4 (dag);
+    ASSERT_EQ (checkTopologicalSorting (L, dag), true);
+    // the graph is not modified
+    ASSERT_EQ (dag.isEmpty(), false);
+  }
+  
+  {
+    auto edges = createLayeredDAGEdges (100, 100, 4);
+    
+    auto L = topologicalSortAdjList4 (createGraphAdjListFromEdges (edges));
+    ASSERT_EQ (checkTopologicalSorting (L, createGraphCSRFromEdges (edges)), true);
+  }
+  
+  {
+    auto dag = createGraphAdjListFromEdges (std::vector <Edge> ({
+        Edge (0, 1)
+      , Edge (1, 2)
+      , Edge (2, 0)
+      , Edge (3, 0)
+    }));
+    
+    ASSERT_THROW (topologicalSortAdjList4 (dag), std::invalid_argument);
+  }
+}
+
 TEST (correctness, topologicalSortCormanAdjList2) {
   {
     GraphAdjList posDag;
@@ -604,9 +841,7 @@ TEST (correctness, topologicalSortCormanAdjList2) {
     for (unsigned int i = 0; i < nTests; i++) {
       std::cout << "sort random DAG " << (i + 1) << "/" << nTests << std::endl;
       
-      auto filename = createRandomDAG (0.65, i);
-      
-      auto edges = readEdgesFromFile (filename);
+      auto edges = createRandomDAG (0.65, i);
       
       auto dagAdjList = createGraphAdjListFromEdges (edges);
       auto L = topologicalSortCormanAdjList2 (dagAdjList);
@@ -624,22 +859,12 @@ TEST (correctness, topologicalSortCormanAdjList) {
   }
   
   {
-    std::string filename = "/home/bach/Documents/algorithm-exercises/topological-sorting/example-graphs/test-graph.dat";
-    
     unsigned int nTests = 20;
     
     for (unsigned int i = 0; i < nTests; i++) {
       std::cout << "sort random DAG " << (i + 1) << "/" << nTests << std::endl;
       // create a random DAG
-      char buffer[2048];
-      sprintf (buffer
-      , "Rscript scripts/createRandomDAG-moreRandom.R 512 0.75 %s %i"
-      , filename.c_str()
-      , i + 1);
-      if (system ((char *) buffer)) 
-        std::cout << "something went wrong in the R script" << std::endl;
-      
-      auto edges = readEdgesFromFile (filename);
+      auto edges = createMoreRandomDAGEdges (512, 0.75, i + 1);
       auto dagAdjList = createGraphAdjListFromEdges (edges);
       auto L = topologicalSortCormanAdjList (dagAdjList);      
       
@@ -651,6 +876,691 @@ TEST (correctness, topologicalSortCormanAdjList) {
   }
 }
 
+TEST (correctness, topologicalSortCormanAdjList3) {
+  {
+    GraphAdjList posDag;
+    
+    auto L = topologicalSortCormanAdjList3 (posDag);
+    ASSERT_EQ (checkTopologicalSorting (L, posDag), true);
+  }
+  
+  {
+    // unlike 'topologicalSortCormanAdjList2' the nodes of a graph without edges are sorted
+    GraphAdjList posDag (3);
+    
+    ASSERT_EQ (topologicalSortCormanAdjList3 (posDag), std::vector <unsigned int> ({0, 1, 2}));
+    ASSERT_TRUE (topologicalSortCormanAdjList2 (posDag).empty());
+  }
+  
+  {
+    auto dag = createGraphAdjListFromEdges (readEdgesFromFile ("example-graphs/t1-graph.dat"));
+    
+    auto L = topologicalSortCormanAdjList3 (dag);
+    ASSERT_EQ (checkTopologicalSorting (L, dag), true);
+    // the same roots are chosen like in the recursive implementation
+    ASSERT_EQ (L, topologicalSortCormanAdjList2 (dag));
+  }
+  
+  {
+    auto edges = createLayeredDAGEdges (50, 50, 4);
+    auto dag = createGraphAdjListFromEdges (edges);
+    
+    auto L = topologicalSortCormanAdjList3 (dag);
+    ASSERT_EQ (checkTopologicalSorting (L, createGraphCSRFromEdges (edges)), true);
+    ASSERT_EQ (L, topologicalSortCormanAdjList2 (dag));
+  }
+  
+  {
+    // a long chain would overflow the call-stack of a recursive depth-first search
+    std::vector <Edge> edges;
+    for (unsigned int i = 0; i < 1000000; i++)
+      edges.push_back (Edge (i, i + 1));
+    
+    auto L = topologicalSortCormanAdjList3 (createGraphAdjListFromEdges (edges));
+    ASSERT_EQ (checkTopologicalSorting (L, createGraphCSRFromEdges (edges)), true);
+  }
+  
+  {
+    auto dag = createGraphAdjListFromEdges (std::vector <Edge> ({
+        Edge (0, 1)
+      , Edge (1, 2)
+      , Edge (2, 0)
+      , Edge (3, 0)
+    }));
+    
+    ASSERT_THROW (topologicalSortCormanAdjList3 (dag), std::invalid_argument);
+  }
+}
+
+TEST (correctness, csr_createGraphCSRFromEdges) {
+  {
+    auto graph = createGraphCSRFromEdges (std::vector <Edge> ());
+    ASSERT_EQ (graph.isEmpty(), true);
+    ASSERT_EQ (graph.nNodes(), 0);
+  }
+  
+  {
+    std::vector <Edge> edges ({Edge (0, 1)
+                             , Edge (0, 2)
+                             , Edge (1, 3)
+                             , Edge (2, 3)
+                             , Edge (1, 4)});
+    auto graph = createGraphCSRFromEdges (edges);
+    
+    ASSERT_EQ (graph.isEmpty(), false);
+    ASSERT_EQ (graph.nNodes(), 5);
+    ASSERT_EQ (graph.nEdges(), 5);
+    ASSERT_EQ (graph.outDegree (0), 2);
+    ASSERT_EQ (graph.outDegree (1), 2);
+    ASSERT_EQ (graph.outDegree (4), 0);
+    
+    for (auto & edge : edges)
+      ASSERT_EQ (graph.containsEdge (edge), true);
+    ASSERT_EQ (graph.containsEdge (Edge (1, 0)), false);
+    ASSERT_EQ (graph.containsEdge (Edge (3, 4)), false);
+    
+    // the order of the edges of one source node is kept
+    ASSERT_EQ (*(graph[1].begin()), 3);
+    ASSERT_EQ (*(graph[1].begin() + 1), 4);
+  }
+}
+
+TEST (correctness, csr_createGraphCSRFromEdgesParallel) {
+  {
+    GraphCSR posDag, negDag;
+    createGraphCSRFromEdgesParallel (std::vector <Edge> (), posDag, negDag, 4);
+    ASSERT_EQ (posDag.nNodes(), 0);
+    ASSERT_EQ (negDag.nNodes(), 0);
+  }
+  
+  {
+    // enough edges per thread, so the edges of a node are split over several threads
+    auto edges = createRandomDAGEdges (2000, 0.3, 5);
+    permuteNodeIds (edges, 2000, 5);
+    std::vector <Edge> negEdges;
+    for (auto & edge : edges)
+      negEdges.push_back (Edge (edge.second, edge.first));
+    
+    auto expectedPosDag = createGraphCSRFromEdges (edges);
+    auto expectedNegDag = createGraphCSRFromEdges (negEdges);
+    
+    for (unsigned int nThreads : {1, 2, 3, 4}) {
+      auto graph = createGraphCSRFromEdgesParallel (edges, nThreads);
+      ASSERT_EQ (graph.offsets(), expectedPosDag.offsets());
+      ASSERT_EQ (graph.targets(), expectedPosDag.targets());
+      
+      GraphCSR posDag, negDag;
+      createGraphCSRFromEdgesParallel (edges, posDag, negDag, nThreads);
+      ASSERT_EQ (posDag.offsets(), expectedPosDag.offsets());
+      ASSERT_EQ (posDag.targets(), expectedPosDag.targets());
+      ASSERT_EQ (negDag.offsets(), expectedNegDag.offsets());
+      ASSERT_EQ (negDag.targets(), expectedNegDag.targets());
+    }
+  }
+  
+  {
+    // a sparse graph (|E| / |V| < 2) with enough edges for 8 threads
+    const unsigned int nNodes = 400000;
+    std::vector <Edge> edges;
+    for (unsigned int i = 0; i < 600000; i++)
+      edges.push_back (Edge (uint64_t (i) * 7919 % nNodes, (uint64_t (i) * 104729 + 13) % nNodes));
+    std::vector <Edge> negEdges;
+    for (auto & edge : edges)
+      negEdges.push_back (Edge (edge.second, edge.first));
+    
+    auto expectedPosDag = createGraphCSRFromEdges (edges);
+    auto expectedNegDag = createGraphCSRFromEdges (negEdges);
+    
+    for (unsigned int nThreads : {5, 8}) {
+      GraphCSR posDag, negDag;
+      createGraphCSRFromEdgesParallel (edges, posDag, negDag, nThreads);
+      ASSERT_EQ (posDag.offsets(), expectedPosDag.offsets());
+      ASSERT_EQ (posDag.targets(), expectedPosDag.targets());
+      ASSERT_EQ (negDag.offsets(), expectedNegDag.offsets());
+      ASSERT_EQ (negDag.targets(), expectedNegDag.targets());
+    }
+  }
+  
+  {
+    // the amount of nodes has to fit into the node-id type
+    std::vector <BasicEdge <uint16_t>> edges ({BasicEdge <uint16_t> (0, 65535)});
+    ASSERT_THROW (createGraphCSRFromEdgesParallel (edges), std::invalid_argument);
+  }
+}
+
+TEST (correctness, csr_checkTopologicalSorting) {
+  {
+    auto dag = createGraphCSRFromEdges (readEdgesFromFile ("example-graphs/t1-graph.dat"));
+    ASSERT_EQ (checkTopologicalSorting ({5, 6, 4, 3, 2, 0, 1}, dag), true);
+    ASSERT_EQ (checkTopologicalSorting ({1, 6, 4, 3, 2, 0, 5}, dag), false);
+    // not a permutation of the nodes
+    ASSERT_EQ (checkTopologicalSorting ({5, 6, 4, 3, 2, 0, 0}, dag), false);
+    ASSERT_EQ (checkTopologicalSorting ({5, 6, 4, 3, 2, 0, 7}, dag), false);
+  }
+  {
+    auto dag = createGraphCSRFromEdges (std::vector <Edge> ());
+    ASSERT_EQ (checkTopologicalSorting ({}, dag), true);
+  }
+  {
+    auto dag = createGraphCSRFromEdges (std::vector <Edge> ({
+        Edge (1, 2)
+      , Edge (2, 3)
+      , Edge (1, 3)
+      , Edge (2, 4)
+      , Edge (0, 1)
+      , Edge (0, 4)
+    }));
+    ASSERT_EQ (checkTopologicalSorting ({0, 1, 2, 3, 4}, dag), true);
+    ASSERT_EQ (checkTopologicalSorting ({0, 4, 1, 2, 3}, dag), false);
+    ASSERT_THROW (checkTopologicalSorting ({0, 1, 2, 3}, dag), std::invalid_argument);
+  }
+}
+
+TEST (correctness, topologicalSortCSR) {
+  {
+    GraphCSR dag;
+    
+    auto L = topologicalSortCSR (dag);
+    ASSERT_EQ (checkTopologicalSorting (L, dag), true);
+  }
+  
+  {
+    auto edges = readEdgesFromFile ("example-graphs/t1-graph.dat");
+    
+    auto L = topologicalSortCSR (createGraphCSRFromEdges (edges));
+    ASSERT_EQ (checkTopologicalSorting (L, createGraphAdjListFromEdges (edges)), true);
+  }
+  
+  {
+    // NOTE: nodes without any edge are part of the sorting as well
+    auto dag = createGraphCSRFromEdges (std::vector <Edge> ({Edge (3, 1)}));
+    
+    auto L = topologicalSortCSR (dag);
+    ASSERT_EQ (L.size(), 4);
+    ASSERT_EQ (checkTopologicalSorting (L, dag), true);
+  }
+  
+  {
+    auto dag = createGraphCSRFromEdges (std::vector <Edge> ({
+        Edge (0, 1)
+      , Edge (1, 2)
+      , Edge (2, 0)
+      , Edge (3, 0)
+    }));
+    
+    ASSERT_THROW (topologicalSortCSR (dag), std::invalid_argument);
+  }
+}
+
+TEST (correctness, topologicalSortCormanCSR) {
+  {
+    GraphCSR dag;
+    
+    auto L = topologicalSortCormanCSR (dag);
+    ASSERT_EQ (checkTopologicalSorting (L, dag), true);
+  }
+  
+  {
+    auto edges = readEdgesFromFile ("example-graphs/t1-graph.dat");
+    
+    auto L = topologicalSortCormanCSR (createGraphCSRFromEdges (edges));
+    ASSERT_EQ (checkTopologicalSorting (L, createGraphAdjListFromEdges (edges)), true);
+  }
+  
+  {
+    // a long chain would overflow the call-stack of a recursive depth-first search
+    std::vector <Edge> edges;
+    for (unsigned int i = 0; i < 1000000; i++)
+      edges.push_back (Edge (i, i + 1));
+    auto dag = createGraphCSRFromEdges (edges);
+    
+    auto L = topologicalSortCormanCSR (dag);
+    ASSERT_EQ (checkTopologicalSorting (L, dag), true);
+  }
+  
+  {
+    auto dag = createGraphCSRFromEdges (std::vector <Edge> ({
+        Edge (0, 1)
+      , Edge (1, 2)
+      , Edge (2, 0)
+      , Edge (3, 0)
+    }));
+    
+    ASSERT_THROW (topologicalSortCormanCSR (dag), std::invalid_argument);
+  }
+}
+
+TEST (correctness, graphCompressed) {
+  {
+    auto graph = createGraphCompressedFromEdges (std::vector <Edge> ());
+    ASSERT_EQ (graph.isEmpty(), true);
+    ASSERT_EQ (graph.nNodes(), 0);
+    ASSERT_EQ (topologicalSortCompressed (graph).size(), 0);
+  }
+  
+  {
+    // targets smaller than the source, large differences and duplicated edges
+    std::vector <Edge> edges ({Edge (5, 1)
+                             , Edge (5, 0)
+                             , Edge (5, 100000)
+                             , Edge (5, 7)
+                             , Edge (2, 3)
+                             , Edge (2, 3)
+                             , Edge (0, 4)});
+    auto graph = createGraphCompressedFromEdges (edges);
+    
+    ASSERT_EQ (graph.nNodes(), 100001);
+    ASSERT_EQ (graph.nEdges(), 7);
+    for (auto & edge : edges)
+      ASSERT_EQ (graph.containsEdge (edge), true);
+    ASSERT_EQ (graph.containsEdge (Edge (5, 2)), false);
+    
+    // the targets of a node are sorted
+    ASSERT_EQ (std::vector <unsigned int> (graph[5].begin(), graph[5].end()), std::vector <unsigned int> ({0, 1, 7, 100000}));
+    ASSERT_EQ (std::vector <unsigned int> (graph[2].begin(), graph[2].end()), std::vector <unsigned int> ({3, 3}));
+    ASSERT_EQ (graph[1].empty(), true);
+    ASSERT_EQ (graph[1].begin() == graph[1].end(), true);
+  }
+  
+  {
+    // the largest node-ids use all bytes of a varint
+    std::vector <BasicEdge <uint64_t>> edges ({BasicEdge <uint64_t> (0, 3), BasicEdge <uint64_t> (3, 1)});
+    auto graph = createGraphCompressedFromEdges (edges);
+    ASSERT_EQ (graph.encodeFirstTarget (0, std::numeric_limits <uint64_t>::max() - 1), 3u);
+    ASSERT_EQ (graph.decodeFirstTarget (0, 3), std::numeric_limits <uint64_t>::max() - 1);
+    ASSERT_EQ (graph.decodeFirstTarget (1, graph.encodeFirstTarget (1, std::numeric_limits <uint64_t>::max() - 1)), std::numeric_limits <uint64_t>::max() - 1);
+    
+    std::vector <uint8_t> bytes;
+    GraphCompressed::encodeVarint (std::numeric_limits <uint64_t>::max(), bytes);
+    ASSERT_EQ (bytes.size(), 10);
+    bytes.push_back (0);
+    uint64_t value;
+    ASSERT_EQ (GraphCompressed::decodeVarint (bytes.data(), value), bytes.data() + 10);
+    ASSERT_EQ (value, std::numeric_limits <uint64_t>::max());
+    
+    ASSERT_EQ (topologicalSortCompressed (graph), std::vector <uint64_t> ({0, 2, 3, 1}));
+  }
+  
+  {
+    for (unsigned int i = 0; i < 5; i++) {
+      // sorted adjacency lists, so the sortings equal the ones on the CSR graph
+      auto edges = createRandomDAGEdges (2000, 0.05, i);
+      std::sort (edges.begin(), edges.end());
+      auto dagCSR = createGraphCSRFromEdges (edges);
+      auto dag = createGraphCompressedFromCSR (dagCSR);
+      
+      ASSERT_EQ (dag.nEdges(), dagCSR.nEdges());
+      ASSERT_LT (dag.bytes().size(), dagCSR.nEdges() * 2);
+      ASSERT_EQ (getInDegree (dag), getInDegree (dagCSR));
+      ASSERT_EQ (topologicalSortCompressed (dag), topologicalSortCSR (dagCSR));
+      ASSERT_EQ (topologicalSortCormanCompressed (dag), topologicalSortCormanCSR (dagCSR));
+      ASSERT_EQ (checkTopologicalSorting (topologicalSortCompressed (dag), dag), true);
+    }
+  }
+  
+  {
+    auto dag = createGraphCompressedFromEdges (std::vector <Edge> ({
+        Edge (0, 1)
+      , Edge (1, 2)
+      , Edge (2, 0)
+      , Edge (3, 0)
+    }));
+    
+    ASSERT_EQ (findCycle (dag).size(), 3);
+    ASSERT_THROW (topologicalSortCompressed (dag), GraphCycleException);
+    ASSERT_THROW (topologicalSortCormanCompressed (dag), GraphCycleException);
+  }
+}
+
+TEST (correctness, topologicalSortLexMin) {
+  {
+    GraphCSR dag;
+    
+    ASSERT_EQ (topologicalSortLexMin (dag).size(), 0);
+  }
+  
+  {
+    // the node 0 becomes ready after the larger nodes 2 and 3, but is sorted before 4
+    auto dag = createGraphCSRFromEdges (std::vector <Edge> ({
+        Edge (3, 0)
+      , Edge (2, 0)
+      , Edge (0, 1)
+      , Edge (3, 4)
+    }));
+    
+    ASSERT_EQ (topologicalSortLexMin (dag), std::vector <unsigned int> ({2, 3, 0, 1, 4}));
+  }
+  
+  {
+    // more than 64 * 64 nodes, so the bitset has three levels
+    for (unsigned int i = 0; i < 3; i++) {
+      auto posEdges = createRandomDAGEdges (5000, 0.001, i);
+      permuteNodeIds (posEdges, 5000, i);
+      std::vector <Edge> negEdges;
+      for (auto & edge : posEdges)
+        negEdges.push_back (Edge (edge.second, edge.first));
+      
+      auto posDagAdjList = createGraphAdjListFromEdges (posEdges);
+      auto negDagAdjList = createGraphAdjListFromEdges (negEdges);
+      
+      // the same lexicographically smallest sorting as the one using a std::set
+      auto L = topologicalSortAdjList2 (posDagAdjList, negDagAdjList);
+      ASSERT_EQ (topologicalSortLexMin (posDagAdjList), L);
+      ASSERT_EQ (topologicalSortLexMin (createGraphCSRFromEdges (posEdges)), L);
+    }
+  }
+  
+  {
+    auto dag = createGraphCSRFromEdges (std::vector <Edge> ({
+        Edge (0, 1)
+      , Edge (1, 2)
+      , Edge (2, 0)
+      , Edge (3, 0)
+    }));
+    
+    ASSERT_THROW (topologicalSortLexMin (dag), GraphCycleException);
+  }
+}
+
+TEST (correctness, topologicalSortPriority) {
+  {
+    GraphCSR dag;
+    
+    ASSERT_EQ (topologicalSortPriority (dag, std::vector <double> ()).size(), 0);
+  }
+  
+  {
+    // the long chain 3 -> 4 -> 5 is released first, 0 and 1 have the same priority
+    auto dag = createGraphCSRFromEdges (std::vector <Edge> ({
+        Edge (3, 4)
+      , Edge (4, 5)
+      , Edge (2, 5)
+    }));
+    
+    auto L = topologicalSortPriority (dag, std::vector <double> ({1, 1, 0.5, 3, 2, 1}));
+    ASSERT_EQ (L, std::vector <unsigned int> ({3, 4, 0, 1, 2, 5}));
+  }
+  
+  {
+    for (unsigned int i = 0; i < 5; i++) {
+      auto edges = createRandomDAGEdges (3000, 0.002, i);
+      permuteNodeIds (edges, 3000, i);
+      auto dagAdjList = createGraphAdjListFromEdges (edges);
+      auto dagCSR = createGraphCSRFromEdges (edges);
+      
+      // few different priorities, so there are many ties
+      std::vector <double> priorities (dagCSR.nNodes());
+      for (std::size_t nodeId = 0; nodeId < priorities.size(); nodeId++)
+        priorities[nodeId] = (nodeId * 7919) % 13;
+      
+      // reference using a std::set ordered by the negated priority and the id
+      auto inDegree = getInDegree (dagCSR);
+      std::set <std::pair <double, unsigned int>> S;
+      for (unsigned int nodeId = 0; nodeId < dagCSR.nNodes(); nodeId++)
+        if (inDegree[nodeId] == 0)
+          S.insert (std::make_pair (-priorities[nodeId], nodeId));
+      std::vector <unsigned int> expected;
+      while (! S.empty()) {
+        auto n = S.begin()->second;
+        S.erase (S.begin());
+        expected.push_back (n);
+        for (auto targetNodeId : dagCSR[n])
+          if (--inDegree[targetNodeId] == 0)
+            S.insert (std::make_pair (-priorities[targetNodeId], targetNodeId));
+      }
+      
+      ASSERT_EQ (topologicalSortPriority (dagCSR, priorities), expected);
+      ASSERT_EQ (topologicalSortPriority (dagAdjList, priorities), expected);
+      
+      // equal priorities give the lexicographically smallest sorting
+      std::vector <double> equalPriorities (dagCSR.nNodes(), 1);
+      ASSERT_EQ (topologicalSortPriority (dagCSR, equalPriorities), topologicalSortLexMin (dagCSR));
+    }
+  }
+  
+  {
+    auto dag = createGraphCSRFromEdges (std::vector <Edge> ({
+        Edge (0, 1)
+      , Edge (1, 2)
+      , Edge (2, 0)
+      , Edge (3, 0)
+    }));
+    
+    ASSERT_THROW (topologicalSortPriority (dag, std::vector <double> (3)), std::invalid_argument);
+    ASSERT_THROW (topologicalSortPriority (dag, std::vector <double> (4)), GraphCycleException);
+  }
+}
+
+TEST (correctness, topologicalSortLevels) {
+  {
+    auto levels = topologicalSortLevels (GraphCSR());
+    ASSERT_EQ (levels.nLevels(), 0);
+    ASSERT_EQ (levels.nodes.size(), 0);
+  }
+  
+  {
+    auto dag = createGraphAdjListFromEdges (readEdgesFromFile ("example-graphs/t1-graph.dat"));
+    
+    auto levels = topologicalSortLevels (dag);
+    ASSERT_EQ (checkTopologicalSorting (levels.nodes, dag), true);
+    ASSERT_EQ (levels.levelOffsets, std::vector <unsigned int> ({0, 2, 6, 7}));
+    
+    // the nodes of one level can be in any order
+    std::vector <std::vector <unsigned int>> expectedLevels ({{5, 6}, {0, 2, 3, 4}, {1}});
+    for (unsigned int level = 0; level < levels.nLevels(); level++) {
+      std::vector <unsigned int> nodes (levels.nodes.begin() + levels.levelOffsets[level]
+                                      , levels.nodes.begin() + levels.levelOffsets[level + 1]);
+      std::sort (nodes.begin(), nodes.end());
+      ASSERT_EQ (nodes, expectedLevels[level]);
+    }
+  }
+  
+  {
+    // every node is in the level given by its longest path from a source
+    auto edges = createLayeredDAGEdges (30, 40, 3);
+    edges.push_back (Edge (0, 29 * 40));
+    auto dag = createGraphCSRFromEdges (edges);
+    
+    auto levels = topologicalSortLevels (dag);
+    ASSERT_EQ (checkTopologicalSorting (levels.nodes, dag), true);
+    
+    std::vector <unsigned int> longestPath (dag.nNodes(), 0);
+    for (auto sourceNodeId : levels.nodes)
+      for (auto targetNodeId : dag[sourceNodeId])
+        longestPath[targetNodeId] = std::max (longestPath[targetNodeId], longestPath[sourceNodeId] + 1);
+    
+    for (unsigned int level = 0; level < levels.nLevels(); level++)
+      for (auto i = levels.levelOffsets[level]; i < levels.levelOffsets[level + 1]; i++)
+        ASSERT_EQ (longestPath[levels.nodes[i]], level);
+  }
+  
+  {
+    auto dag = createGraphAdjListFromEdges (std::vector <Edge> ({
+        Edge (0, 1)
+      , Edge (1, 2)
+      , Edge (2, 0)
+      , Edge (3, 0)
+    }));
+    
+    ASSERT_THROW (topologicalSortLevels (dag), std::invalid_argument);
+  }
+}
+
+TEST (correctness, topologicalSortParallel) {
+  {
+    GraphCSR dag;
+    
+    auto L = topologicalSortParallel (dag);
+    ASSERT_EQ (checkTopologicalSorting (L, dag), true);
+  }
+  
+  {
+    auto edges = readEdgesFromFile ("example-graphs/t1-graph.dat");
+    auto dagAdjList = createGraphAdjListFromEdges (edges);
+    
+    ASSERT_EQ (checkTopologicalSorting (topologicalSortParallel (dagAdjList), dagAdjList), true);
+    ASSERT_EQ (checkTopologicalSorting (topologicalSortParallel (createGraphCSRFromEdges (edges)), dagAdjList), true);
+  }
+  
+  for (unsigned int nThreads = 1; nThreads <= 4; nThreads++) {
+    // a wide and a deep DAG
+    for (auto edges : {createLayeredDAGEdges (8, 20000, 3), createLayeredDAGEdges (20000, 8, 2)}) {
+      auto dag = createGraphCSRFromEdges (edges);
+      ASSERT_EQ (checkTopologicalSorting (topologicalSortParallel (dag, nThreads), dag), true);
+    }
+    
+    auto dagAdjList = createGraphAdjListFromEdges (createLayeredDAGEdges (8, 20000, 3));
+    ASSERT_EQ (checkTopologicalSorting (topologicalSortParallel (dagAdjList, nThreads), createGraphCSRFromEdges (createLayeredDAGEdges (8, 20000, 3))), true);
+  }
+  
+  {
+    auto edges = createLayeredDAGEdges (8, 20000, 3);
+    edges.push_back (Edge (7 * 20000, 7 * 20000 + 1));
+    edges.push_back (Edge (7 * 20000 + 1, 7 * 20000));
+    
+    ASSERT_THROW (topologicalSortParallel (createGraphCSRFromEdges (edges), 4), std::invalid_argument);
+    ASSERT_THROW (topologicalSortParallel (createGraphAdjListFromEdges (edges), 4), std::invalid_argument);
+  }
+}
+
+TEST (correctness, findCycle) {
+  {
+    auto edges = readEdgesFromFile ("example-graphs/t1-graph.dat");
+    
+    ASSERT_EQ (findCycle (createGraphAdjListFromEdges (edges)).empty(), true);
+    ASSERT_EQ (findCycle (createGraphCSRFromEdges (edges)).empty(), true);
+    
+    // 1 -> 5 closes the cycle 5 -> 3 -> 1 -> 5
+    edges.push_back (Edge (1, 5));
+    
+    auto cycle = findCycle (createGraphAdjListFromEdges (edges));
+    ASSERT_EQ (cycle.size(), 3);
+    ASSERT_EQ (isCycle (cycle, edges), true);
+    ASSERT_EQ (isCycle (findCycle (createGraphCSRFromEdges (edges)), edges), true);
+  }
+  
+  {
+    // a self-loop
+    std::vector <Edge> edges = {Edge (0, 1), Edge (1, 1)};
+    
+    ASSERT_EQ (findCycle (createGraphCSRFromEdges (edges)), std::vector <unsigned int> ({1}));
+  }
+}
+
+TEST (correctness, graphCycleException) {
+  // the cycle lies behind a long path and nodes, which are only reachable from the cycle
+  auto edges = createLayeredDAGEdges (100, 50, 2);
+  edges.push_back (Edge (60 * 50, 59 * 50 + 7));
+  edges.push_back (Edge (59 * 50 + 7, 60 * 50));
+  
+  auto dagAdjList = createGraphAdjListFromEdges (edges);
+  auto dagCSR = createGraphCSRFromEdges (edges);
+  auto dagBitMatrix = createBitMatrixFromEdges (edges);
+  
+  std::vector <std::function <void ()>> topSortFunctions = {
+      [&]() { topologicalSortAdjList3 (dagAdjList); }
+    , [&]() { topologicalSortAdjList4 (dagAdjList); }
+    , [&]() { topologicalSortCormanAdjList3 (dagAdjList); }
+    , [&]() { topologicalSortCSR (dagCSR); }
+    , [&]() { topologicalSortCormanCSR (dagCSR); }
+    , [&]() { topologicalSortLevels (dagAdjList); }
+    , [&]() { topologicalSortLevels (dagCSR); }
+    , [&]() { topologicalSortParallel (dagCSR, 4); }
+    , [&]() { topologicalSortBitMatrix (dagBitMatrix); }
+  };
+  
+  for (auto & topSortFunction : topSortFunctions) {
+    ASSERT_THROW (topSortFunction(), std::invalid_argument);
+    
+    try {
+      topSortFunction();
+    } catch (const GraphCycleException & e) {
+      ASSERT_EQ (isCycle (e.cycle(), edges), true);
+      ASSERT_NE (std::string (e.what()).find ("cycle: "), std::string::npos);
+    }
+  }
+}
+
+// Function to sort a random DAG using all sorting functions for the node-id type 'NodeId'
+template <typename NodeId>
+static void checkNodeIdType (void) {
+  auto edges = convertEdges <NodeId> (createMoreRandomDAGEdges (300, 0.1, 5));
+  
+  auto dagAdjList = createGraphAdjListFromEdges (edges);
+  auto dagCSR = createGraphCSRFromEdges (edges);
+  ASSERT_EQ (sizeof (dagCSR.targets()[0]), sizeof (NodeId));
+  
+  std::vector <std::vector <NodeId>> sortings = {
+      topologicalSortAdjList4 (dagAdjList)
+    , topologicalSortCormanAdjList3 (dagAdjList)
+    , topologicalSortCSR (dagCSR)
+    , topologicalSortCormanCSR (dagCSR)
+    , topologicalSortLevels (dagAdjList).nodes
+    , topologicalSortLevels (dagCSR).nodes
+    , topologicalSortParallel (dagAdjList, 4)
+    , topologicalSortParallel (dagCSR, 4)
+  };
+  for (auto & sorting : sortings) {
+    ASSERT_EQ (checkTopologicalSorting (sorting, dagAdjList), true);
+    ASSERT_EQ (checkTopologicalSorting (sorting, dagCSR), true);
+  }
+  ASSERT_EQ (findCycle (dagCSR).empty(), true);
+  
+  // the cycle is reported with the node-id type of the graph
+  edges.push_back (BasicEdge <NodeId> (edges.front().second, edges.front().first));
+  try {
+    topologicalSortCSR (createGraphCSRFromEdges (edges));
+    FAIL();
+  } catch (const BasicGraphCycleException <NodeId> & e) {
+    ASSERT_EQ (e.cycle().size() >= 2, true);
+  }
+}
+
+TEST (correctness, nodeIdTypes) {
+  checkNodeIdType <uint16_t> ();
+  checkNodeIdType <uint32_t> ();
+  checkNodeIdType <uint64_t> ();
+  
+  // the amount of nodes has to fit into the node-id type
+  ASSERT_THROW (createGraphCSRFromEdges (std::vector <BasicEdge <uint16_t>> ({BasicEdge <uint16_t> (0, 65535)})), std::invalid_argument);
+  ASSERT_THROW (convertEdges <uint16_t> (std::vector <Edge> ({Edge (0, 65536)})), std::invalid_argument);
+  ASSERT_EQ (createGraphCSRFromEdges (std::vector <BasicEdge <uint16_t>> ({BasicEdge <uint16_t> (0, 65534)})).nNodes(), 65535u);
+  
+  // node-ids above 2^32 are kept
+  const uint64_t largeNodeId = (uint64_t (1) << 32) + 5;
+  std::vector <BasicEdge <uint64_t>> edges = {BasicEdge <uint64_t> (largeNodeId, 3), BasicEdge <uint64_t> (3, 7)};
+  ASSERT_EQ (getMaxNodeId (edges), largeNodeId);
+  ASSERT_THROW (convertEdges <uint32_t> (edges), std::invalid_argument);
+}
+
+TEST (correctness, nodeIdTypes_parallelEdges) {
+  // 2^16 parallel edges into one node of a graph with 16-bit node-ids
+  typedef BasicEdge <uint16_t> Edge16;
+  std::vector <Edge16> edges (65536, Edge16 (0, 1));
+  edges.push_back (Edge16 (2, 1));
+  
+  auto dagCSR = createGraphCSRFromEdges (edges);
+  auto dag = createGraphAdjListFromEdges (edges);
+  auto inDegree = getInDegree (dagCSR);
+  ASSERT_EQ (inDegree[1], 65537u);
+  ASSERT_EQ (getInDegree (dag), inDegree);
+  ASSERT_EQ (getInDegree (createGraphCompressedFromCSR (dagCSR)), inDegree);
+  
+  const std::vector <uint16_t> expected ({0, 2, 1});
+  ASSERT_EQ (topologicalSortCSR (dagCSR), expected);
+  ASSERT_EQ (topologicalSortAdjList4 (dag), expected);
+  ASSERT_EQ (topologicalSortCompressed (createGraphCompressedFromCSR (dagCSR)), expected);
+  ASSERT_EQ (topologicalSortLexMin (dagCSR), expected);
+  ASSERT_EQ (topologicalSortPriority (dagCSR, std::vector <double> (3, 0.0)), expected);
+  ASSERT_EQ (topologicalSortLevels (dagCSR).nodes, expected);
+  for (unsigned int nThreads : {1, 2})
+    ASSERT_EQ (checkTopologicalSorting (topologicalSortParallel (dagCSR, nThreads), dagCSR), true);
+  
+  SortScratch <BasicGraphCSR <uint16_t>> scratch;
+  ASSERT_EQ (topologicalSortCSR (dagCSR, scratch), expected);
+  ASSERT_EQ (checkTopologicalSorting (topologicalSortCormanCSR (dagCSR, scratch), dagCSR), true);
+}
+
 // measure implementations of topological sorting
 // TEST (measurements, topologicalSortAdjMatrix) { 
 //   typedef std::function <std::vector <unsigned int> (Graph)> TopologicalSortFunctionHandle;
@@ -680,7 +1590,7 @@ TEST (correctness, topologicalSortCormanAdjList) {
 //   std::vector <float> scenarios = {0.25, 0.9};
 //   
 //   // configure file-operations
-//   const std::string resultDir = "/home/bach/Documents/algorithm-exercises/topological-sorting/measurements/";
+//   const std::string resultDir = "measurements/";
 //   
 //   char temp [256];
 //   std::sprintf (temp, "# %2s %10s %10s %10s %10s %15s\n", "n", "min[us]", "max[us]", "mean[us]", "sd[us]", "measurements[us]");
@@ -762,7 +1672,7 @@ TEST (correctness, topologicalSortCormanAdjList) {
 //   std::vector <float> scenarios = {0.25, 0.9};
 //   
 //   // configure file-operations
-//   const std::string resultDir = "/home/bach/Documents/algorithm-exercises/topological-sorting/measurements/";
+//   const std::string resultDir = "measurements/";
 //   
 //   char temp [256];
 //   std::sprintf (temp, "# %2s %10s %10s %10s %10s %15s\n", "n", "min[us]", "max[us]", "mean[us]", "sd[us]", "measurements[us]");
@@ -844,7 +1754,7 @@ TEST (correctness, topologicalSortCormanAdjList) {
 //   std::vector <float> scenarios = {0.25, 0.9};
 //   
 //   // configure file-operations
-//   const std::string resultDir = "/home/bach/Documents/algorithm-exercises/topological-sorting/measurements/";
+//   const std::string resultDir = "measurements/";
 //   
 //   char temp [256];
 //   std::sprintf (temp, "# %2s %10s %10s %10s %10s %15s\n", "n", "min[us]", "max[us]", "mean[us]", "sd[us]", "measurements[us]");
@@ -929,7 +1839,7 @@ TEST (measurements, topologicalSortCormanAdjList){
   std::vector <float> scenarios = {0.50};
   
   // configure file-operations
-  const std::string resultDir = "/home/bach/Documents/algorithm-exercises/topological-sorting/measurements/";
+  const std::string resultDir = "measurements/";
   
   char temp [256];
   std::sprintf (temp, "# %2s %10s %10s %10s %10s %15s\n", "n", "min[us]", "max[us]", "mean[us]", "sd[us]", "measurements[us]");
@@ -959,12 +1869,7 @@ TEST (measurements, topologicalSortCormanAdjList){
       
       for (auto it = nNodesInDAG.begin(); it != nNodesInDAG.end(); ++it) {
         // create a random DAG
-        char buffer[1024];
-        sprintf (buffer, "Rscript scripts/createRandomDAG.R %i %.3f", *it, sce);
-        if (system ((char *) buffer)) 
-          std::cout << "something went wrong in the R script" << std::endl;
-        
-        auto edges = readEdgesFromFile ("/home/bach/Documents/algorithm-exercises/topological-sorting/example-graphs/benchmark-graph.dat");
+        auto edges = createRandomDAGEdges (*it, sce);
         
         auto dag = createGraphAdjListFromEdges (edges);
         timeDurationMeasurements.setRow (i
@@ -982,8 +1887,6 @@ TEST (measurements, topologicalSortCormanAdjList){
 
 // profiling sorting functions
 TEST (profiling, topologicalSorting) {
-  std::string filename = "/home/bach/Documents/algorithm-exercises/topological-sorting/example-graphs/test-graph.dat";
-  
   std::vector <GraphAdjList> dags;
   
   unsigned int nDags = 1;
@@ -991,15 +1894,7 @@ TEST (profiling, topologicalSorting) {
   for (unsigned int i = 0; i < nDags; i++) {
     std::cout << "sort random DAG " << (i + 1) << "/" << nDags << std::endl;
     // create a random DAG
-    char buffer[2048];
-    sprintf (buffer
-    , "Rscript scripts/createRandomDAG-moreRandom.R 2048 0.75 %s %i"
-    , filename.c_str()
-    , i);
-    if (system ((char *) buffer)) 
-      std::cout << "something went wrong in the R script" << std::endl;
-    
-    dags.push_back(createGraphAdjListFromEdges (readEdgesFromFile (filename)));
+    dags.push_back(createGraphAdjListFromEdges (createMoreRandomDAGEdges (2048, 0.75, i)));
   }
   
   for (auto & dag : dags) {
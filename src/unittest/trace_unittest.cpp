@@ -0,0 +1,48 @@
+#include "gtest/gtest.h"
+
+#include "trace.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+static std::string readFile (const std::string & filename) {
+  std::ifstream iFile (filename);
+  std::stringstream content;
+  content << iFile.rdbuf();
+  return content.str();
+}
+
+TEST (correctness, trace) {
+  clearTrace();
+  {
+    TraceScope scope ("outer");
+    TraceScope phase ("outer:phase");
+    phase.stop();
+    recordTraceCounter ("outer:counter", 42);
+  }
+  // stop and the destructor record the phase only once
+  EXPECT_EQ (getTraceSize(), 3u);
+
+  writeTraceCSV ("trace_unittest.csv");
+  auto csv = readFile ("trace_unittest.csv");
+  EXPECT_EQ (csv.find ("type,name,thread,start_ns,duration_ns,value\n"), 0u);
+  EXPECT_NE (csv.find ("scope,outer:phase,"), std::string::npos);
+  EXPECT_NE (csv.find ("scope,outer,"), std::string::npos);
+  EXPECT_NE (csv.find ("counter,outer:counter,"), std::string::npos);
+  EXPECT_NE (csv.find (",42\n"), std::string::npos);
+
+  writeTraceChromeJSON ("trace_unittest.json");
+  auto json = readFile ("trace_unittest.json");
+  EXPECT_NE (json.find ("\"traceEvents\""), std::string::npos);
+  EXPECT_NE (json.find ("\"name\": \"outer\", \"ph\": \"X\""), std::string::npos);
+  EXPECT_NE (json.find ("\"name\": \"outer:counter\", \"ph\": \"C\""), std::string::npos);
+  EXPECT_NE (json.find ("\"value\": 42"), std::string::npos);
+
+  std::remove ("trace_unittest.csv");
+  std::remove ("trace_unittest.json");
+
+  clearTrace();
+  EXPECT_EQ (getTraceSize(), 0u);
+}